@@ -19,6 +19,33 @@ static void CartesianProduct(benchmark::State& state) {
     }
 }
 
+static void CartesianProductForEach(benchmark::State& state) {
+    std::array<int, SizePolicy / 8> a{};
+    std::array<int, SizePolicy / 4> b{};
+    auto cartesian = lz::toIter(a).cartesian(b);
+
+    for (auto _ : state) {
+        int sum = 0;
+        cartesian.forEach([&sum](std::tuple<int&, int&> tup) { sum += std::get<0>(tup) * std::get<1>(tup); });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+static void CartesianProductHandWritten(benchmark::State& state) {
+    std::array<int, SizePolicy / 8> a{};
+    std::array<int, SizePolicy / 4> b{};
+
+    for (auto _ : state) {
+        int sum = 0;
+        for (int x : a) {
+            for (int y : b) {
+                sum += x * y;
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
 static void ChunkIf(benchmark::State& state) {
 	std::array<int, SizePolicy> a = lz::range<int>(SizePolicy).toArray<SizePolicy>();
 	auto half = static_cast<int>(SizePolicy / 2);
@@ -338,6 +365,8 @@ static void JoinString(benchmark::State& state) {
 }
 
 BENCHMARK(CartesianProduct);
+BENCHMARK(CartesianProductForEach);
+BENCHMARK(CartesianProductHandWritten);
 BENCHMARK(ChunkIf);
 BENCHMARK(Chunks);
 BENCHMARK(Concatenate);
@@ -0,0 +1,79 @@
+#pragma once
+
+#ifndef LZ_CACHE_HPP
+#    define LZ_CACHE_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/CacheIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class Allocator>
+class Cache final : public internal::BasicIteratorView<internal::CacheIterator<Iterator, Allocator>> {
+public:
+    using iterator = internal::CacheIterator<Iterator, Allocator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Base = internal::BasicIteratorView<iterator>;
+    using State = internal::CacheBuffer<Iterator, Allocator>;
+
+    explicit Cache(const std::shared_ptr<State>& state) : Base(iterator(state, 0), iterator::end(state)) {
+    }
+
+public:
+    Cache(Iterator begin, Iterator end, const Allocator& allocator) :
+        Cache(std::make_shared<State>(std::move(begin), std::move(end), allocator)) {
+    }
+
+    Cache() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a forward view that evaluates every element of [begin, end) at most once. The first time an element is used, it
+ * is copied into a buffer, from which it is read afterwards.
+ * @details Views are normally evaluated every time they are iterated over, so calling for e.g. `sum()`, `max()` and `toString()`
+ * on a `lz::map` view calls its function three times for every element. If the view is cached, its function is only called once
+ * for every element, and only for the elements that have been used. The buffer is a `std::deque`, which allocates in chunks, so
+ * the elements are never copied again when it grows. All copies of the view (and its iterators) share the same buffer, so the
+ * view cannot be used from multiple threads at once. Example:
+ * ```cpp
+ * auto results = lz::toIter(vec).map([](int i) { return expensive(i); }).cache();
+ * auto sum = results.sum(); // calls expensive
+ * auto max = results.max(); // reads the buffer
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param allocator The allocator of the buffer.
+ * @return A forward view object that evaluates every element of [begin, end) at most once.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Allocator = std::allocator<internal::ValueType<Iterator>>>
+LZ_NODISCARD Cache<Iterator, Allocator> cacheRange(Iterator begin, Iterator end, const Allocator& allocator = Allocator()) {
+    return { std::move(begin), std::move(end), allocator };
+}
+
+/**
+ * @brief Returns a forward view that evaluates every element of `iterable` at most once. See `lz::cacheRange` for more details.
+ * @param iterable The sequence to cache.
+ * @param allocator The allocator of the buffer.
+ * @return A forward view object that evaluates every element of `iterable` at most once.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Iterator = internal::IterTypeFromIterable<Iterable>,
+         class Allocator = std::allocator<internal::ValueType<Iterator>>>
+LZ_NODISCARD Cache<Iterator, Allocator> cache(Iterable&& iterable, const Allocator& allocator = Allocator()) {
+    return cacheRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                      allocator);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_CACHE_HPP
@@ -6,17 +6,40 @@
 #include "detail/BasicIteratorView.hpp"
 #include "detail/CartesianProductIterator.hpp"
 
+#include <numeric>
+
 namespace lz {
+namespace internal {
+template<class... Iterators, std::size_t... Is>
+LZ_CONSTEXPR_CXX_20 typename CartesianProductIterator<Iterators...>::Sizes
+cartesianSizes(const std::tuple<Iterators...>& begin, const std::tuple<Iterators...>& end, IndexSequence<Is...>) {
+    using DifferenceType = typename CartesianProductIterator<Iterators...>::difference_type;
+    return { { static_cast<DifferenceType>(getIterLength(std::get<Is>(begin), std::get<Is>(end)))... } };
+}
+} // namespace internal
+
 template<class... Iterators>
 class CartesianProduct final : public internal::BasicIteratorView<internal::CartesianProductIterator<Iterators...>> {
 public:
     using iterator = internal::CartesianProductIterator<Iterators...>;
     using const_iterator = iterator;
 
+private:
+    using Sizes = typename iterator::Sizes;
+    using DifferenceType = typename iterator::difference_type;
+
+    LZ_CONSTEXPR_CXX_20 CartesianProduct(std::tuple<Iterators...> begin, std::tuple<Iterators...> end, const Sizes& sizes) :
+        internal::BasicIteratorView<iterator>(
+            iterator(begin, end, sizes, 0),
+            iterator(begin, end, sizes,
+                     std::accumulate(sizes.begin(), sizes.end(), DifferenceType{ 1 }, std::multiplies<DifferenceType>()))) {
+    }
+
+public:
     constexpr CartesianProduct() = default;
 
     LZ_CONSTEXPR_CXX_20 CartesianProduct(std::tuple<Iterators...> begin, std::tuple<Iterators...> end) :
-        internal::BasicIteratorView<iterator>(iterator(begin, begin, end), iterator(end, begin, end)) {
+        CartesianProduct(begin, end, internal::cartesianSizes(begin, end, internal::MakeIndexSequence<sizeof...(Iterators)>())) {
     }
 };
 
@@ -27,10 +50,12 @@ public:
 
 /**
  * Creates an iterator view object that, when iterated over, gets all possible combinations of all its values of the iterators.
- * @attention Please note that this is not an actual random access iterator. It uses the 'strongest' operator to increase/decrease
- * the iterators with. If the current iterator is bidirectional, it uses ++/--. If it is random access, it uses +/-. So if all
- * the iterators passed are random access, then this iterator is also true random access. If one of the iterators is bidirectional
- * then that iterator is incremented/decremented using the ++ and -- operators.
+ * @details The position of the iterator is a single linear index, that is decoded as a mixed radix number into an offset per
+ * sequence, where the last sequence is the least significant. If all the iterators passed are random access, then `it + n`,
+ * `it - other` and `it[n]` take O(number of sequences) time, regardless of `n`. This makes it cheap to split the product in
+ * (for e.g.) equally sized parts, using `begin() + n` or `lz::slice`.
+ * @attention Please note that this is not an actual random access iterator if one of the iterators passed is not random access.
+ * In that case, `it + n` advances that iterator from its beginning using ++.
  * @param begin The tuple containing all the beginnings of the sequences.
  * @param end The ending containing all the endings of the sequences.
  * @return A cartesian product view object.
@@ -43,11 +68,9 @@ cartesianRange(std::tuple<Iterators...> begin, std::tuple<Iterators...> end) {
 
 /**
  * Creates an iterator view object that, when iterated over, gets all possible combinations of all its values of the iterables.
- * @attention Please note that this is not an actual random access iterator. It uses the 'strongest' operator to increase/decrease
- * the iterators with. If the current iterator is bidirectional, it uses ++/--. If it is random access, it uses +/-. So if all
- * the iterators passed are random access, then this iterator is also true random access. If one of the iterators is bidirectional
- * then that iterator is incremented/decremented using the ++ and -- operators, and in that case this iterator wouldn't be true
- * random access.
+ * @details See `lz::cartesianRange` for more details.
+ * @attention Please note that this is not an actual random access iterator if one of the iterators passed is not random access.
+ * In that case, `it + n` advances that iterator from its beginning using ++.
  * @param iterables The iterables to make all of the possible combinations with.
  * @return A cartesian product view object.
  */
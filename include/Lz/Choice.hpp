@@ -0,0 +1,162 @@
+#pragma once
+
+#ifndef LZ_CHOICE_HPP
+#    define LZ_CHOICE_HPP
+
+#    include "Random.hpp"
+#    include "detail/ChoiceIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class Generator>
+class Choice final : public internal::BasicIteratorView<internal::ChoiceIterator<Iterator, Generator>> {
+public:
+    using iterator = internal::ChoiceIterator<Iterator, Generator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Base = internal::BasicIteratorView<iterator>;
+
+public:
+    Choice(Iterator begin, std::shared_ptr<const internal::AliasTable> table, Generator& generator, const std::ptrdiff_t amount,
+           const bool isWhileTrueLoop) :
+        Base(iterator(begin, table, generator, 0, isWhileTrueLoop), iterator(begin, table, generator, amount, isWhileTrueLoop)) {
+    }
+
+    Choice() = default;
+
+    /**
+     * Picks a new weighted element, not taking into account the size of this view. This is for pure convenience.
+     * @return A new weighted pick from the underlying sequence.
+     */
+    LZ_NODISCARD typename iterator::reference nextChoice() const {
+        return *this->begin();
+    }
+
+    /**
+     * Picks a new weighted index of the underlying sequence, not taking into account the size of this view.
+     * @return An index in [0, size of the underlying sequence).
+     */
+    LZ_NODISCARD std::size_t nextIndex() const {
+        return this->begin().nextIndex();
+    }
+
+    /**
+     * Bulk sampling terminal. Writes `amount` weighted picks to `outputIterator`, skipping the position bookkeeping of the
+     * iterators of this view. Every pick is O(1).
+     * @param outputIterator The output to write the picks to.
+     * @param amount The amount of elements to pick.
+     * @return The output iterator, one past the last written element.
+     */
+    template<class OutputIterator>
+    OutputIterator choicesTo(OutputIterator outputIterator, const std::size_t amount) const {
+        const iterator it = this->begin();
+        for (std::size_t i = 0; i < amount; ++i, ++outputIterator) {
+            *outputIterator = *it;
+        }
+        return outputIterator;
+    }
+
+    /**
+     * Bulk sampling terminal. Creates a vector containing `amount` weighted picks.
+     * @param amount The amount of elements to pick.
+     * @return A `std::vector<value_type>` containing `amount` weighted picks.
+     */
+    LZ_NODISCARD std::vector<value_type> choices(const std::size_t amount) const {
+        std::vector<value_type> result;
+        result.reserve(amount);
+        choicesTo(std::back_inserter(result), amount);
+        return result;
+    }
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a view that picks elements from [begin, end) with the probability given by their weights in
+ * [beginWeights, endWeights), using Walker's alias method.
+ * @details Building the alias table takes O(n), every pick afterwards is O(1) and uses a single uniform number of 53 bits, which
+ * takes one call to a 64-bit `generator` (such as std::mt19937_64) or two calls to a 32-bit one (such as std::mt19937). The
+ * table is shared between the iterators of the view, so copying the view or its iterators is cheap. Example:
+ * ```cpp
+ * std::array<char, 3> letters = { 'a', 'b', 'c' };
+ * std::array<double, 3> weights = { 0.5, 0.3, 0.2 };
+ * std::mt19937 gen(std::random_device{}());
+ * auto picks = lz::choiceRange(letters.begin(), letters.end(), weights.begin(), weights.end(), gen, 100);
+ * ```
+ * @param begin The beginning of the sequence to pick from. Must be random access.
+ * @param end The ending of the sequence to pick from. Must be random access.
+ * @param beginWeights The beginning of the weights. The weights do not need to sum up to 1.
+ * @param endWeights The ending of the weights. Must have the same length as [begin, end).
+ * @param generator A random number generator, for e.g. std::mt19937.
+ * @param amount The amount of picks. If left empty or equal to `std::numeric_limits<std::size_t>::max()` it is interpreted as
+ * a `while-true` loop.
+ * @return A random access view object that yields weighted picks of [begin, end).
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, LZ_CONCEPT_ITERATOR WeightIterator, class Generator>
+LZ_NODISCARD Choice<Iterator, Generator>
+choiceRange(Iterator begin, Iterator end, WeightIterator beginWeights, WeightIterator endWeights, Generator& generator,
+            const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
+    static_assert(internal::IsRandomAccess<Iterator>::value, "the iterator type must be random access");
+    static_assert(std::is_arithmetic<internal::ValueType<WeightIterator>>::value, "the weights must be arithmetic");
+    LZ_ASSERT(internal::getIterLength(begin, end) == internal::getIterLength(beginWeights, endWeights),
+              "the amount of weights must be equal to the length of the sequence");
+    static_cast<void>(end);
+    auto table = std::make_shared<const internal::AliasTable>(std::move(beginWeights), std::move(endWeights));
+    return { std::move(begin), std::move(table), generator, static_cast<std::ptrdiff_t>(amount),
+             amount == (std::numeric_limits<std::size_t>::max)() };
+}
+
+/**
+ * @brief Returns a view that picks elements from `iterable` with the probability given by their weights in `weights`, using
+ * Walker's alias method. See `lz::choiceRange` for more details.
+ * @param iterable The sequence to pick from. Its iterator must be random access.
+ * @param weights The weights of every element in `iterable`. The weights do not need to sum up to 1.
+ * @param generator A random number generator, for e.g. std::mt19937.
+ * @param amount The amount of picks. If left empty or equal to `std::numeric_limits<std::size_t>::max()` it is interpreted as
+ * a `while-true` loop.
+ * @return A random access view object that yields weighted picks of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE Weights, class Generator>
+LZ_NODISCARD
+    internal::EnableIf<!std::is_arithmetic<Generator>::value, Choice<internal::IterTypeFromIterable<Iterable>, Generator>>
+    choice(Iterable&& iterable, const Weights& weights, Generator& generator,
+           const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
+    return choiceRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                       std::begin(weights), std::end(weights), generator, amount);
+}
+
+/**
+ * @brief Returns a view that picks elements from `iterable` with the probability given by their weights in `weights`, using
+ * Walker's alias method. It uses the same std::mt19937 engine setup as `lz::random`. See `lz::choiceRange` for more details.
+ * Example:
+ * ```cpp
+ * std::vector<std::string> endpoints = { "/", "/search", "/checkout" };
+ * std::vector<int> weights = { 80, 15, 5 };
+ * for (const std::string& endpoint : lz::choice(endpoints, weights, 1000)) {
+ *     // endpoint is "/" 80% of the time
+ * }
+ * ```
+ * @param iterable The sequence to pick from. Its iterator must be random access.
+ * @param weights The weights of every element in `iterable`. The weights do not need to sum up to 1.
+ * @param amount The amount of picks. If left empty or equal to `std::numeric_limits<std::size_t>::max()` it is interpreted as
+ * a `while-true` loop.
+ * @return A random access view object that yields weighted picks of `iterable`.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, LZ_CONCEPT_ITERABLE Weights>
+LZ_NODISCARD Choice<internal::IterTypeFromIterable<Iterable>, std::mt19937>
+choice(Iterable&& iterable, const Weights& weights, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) {
+    static std::mt19937 gen = internal::createMtEngine();
+    return choice(std::forward<Iterable>(iterable), weights, gen, amount);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_CHOICE_HPP
@@ -33,7 +33,7 @@ public:
 
     LZ_CONSTEXPR_CXX_20
     Chunks(Iterator begin, Iterator end, const std::size_t chunkSize) :
-        internal::BasicIteratorView<iterator>(iterator(std::move(begin), chunkSize), iterator(std::move(end), chunkSize)) {
+        internal::BasicIteratorView<iterator>(iterator(std::move(begin), end, chunkSize), iterator(end, end, chunkSize)) {
     }
 
     constexpr Chunks() = default;
@@ -47,6 +47,10 @@ public:
 /**
  * Chops a sequence into chunks of `chunkSize`. The value type of the iterator is another iterator, so a double for loop is
  * necessary to iterate over.
+ * @details If the iterator is random access, moving to the next chunk, `it + n`, `it - other` and `size()` all take O(1) time.
+ * This makes it possible to split the chunks into (for e.g.) equally sized parts using `begin() + n`, and hand every part to a
+ * different thread. If the iterator is not random access, every chunk is found by incrementing the iterator at most `chunkSize`
+ * times.
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param chunkSize The size of the chunks to be.
@@ -61,6 +65,7 @@ chunksRange(Iterator begin, Iterator end, const std::size_t chunkSize) {
 /**
  * Chops a sequence into chunks of `chunkSize`. The value type of the iterator is another iterator, so a double for loop is
  * necessary to iterate over.
+ * @details See `lz::chunksRange` for more details.
  * @param iterable The sequence to be chopped into chunks.
  * @param chunkSize The size of the chunks to be.
  * @return A Chunk iterator view object.
@@ -15,13 +15,23 @@ public:
 
     using value_type = typename iterator::value_type;
 
-    LZ_CONSTEXPR_CXX_20 Enumerate(Iterator begin, Iterator end, const IntType start = 0) :
-        Enumerate(begin, end, static_cast<IntType>(internal::getIterLength(begin, end), start)) {
+private:
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 static internal::EnableIf<internal::IsRandomAccess<I>::value, IntType>
+    endIndex(const Iterator& begin, const Iterator& end, const IntType start) {
+        return static_cast<IntType>(start + (end - begin));
+    }
+
+    // Only the underlying iterators are compared, so the length of the sequence is not needed
+    template<class I = Iterator>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 static internal::EnableIf<!internal::IsRandomAccess<I>::value, IntType>
+    endIndex(const Iterator&, const Iterator&, const IntType start) {
+        return start;
     }
 
-    LZ_CONSTEXPR_CXX_20
-    Enumerate(Iterator begin, Iterator end, const internal::DiffType<iterator> distance, const IntType start = 0) :
-        internal::BasicIteratorView<iterator>(iterator(start, begin), iterator(static_cast<IntType>(distance), end)) {
+public:
+    LZ_CONSTEXPR_CXX_20 Enumerate(Iterator begin, Iterator end, const IntType start = 0) :
+        internal::BasicIteratorView<iterator>(iterator(start, begin), iterator(endIndex(begin, end, start), end)) {
     }
 
     constexpr Enumerate() = default;
@@ -38,7 +48,8 @@ public:
  * @details Creates an Enumerate object. The enumerator consists of a `std::pair<Arithmetic, value_type&>`. The
  * elements of the enumerate iterator are by reference. The `std:::pair<Arithmetic, value_type&>::first` is the
  * counter index. The `std:::pair<Arithmetic, value_type&>::second` is the element of the iterator by reference.
- * Furthermore, the `operator*` of this iterator returns an std::pair by value.
+ * Furthermore, the `operator*` of this iterator returns an std::pair by value. If `Iterator` is not random access, the
+ * sequence is not walked up front to calculate its length, and the iterator is at most a forward iterator.
  * @tparam Arithmetic The type of the iterator integer. By default, `int` is assumed. Can be any arithmetic type.
  * @param begin Beginning of the iterator.
  * @param end Ending of the iterator.
@@ -61,7 +72,8 @@ enumerateRange(Iterator begin, Iterator end, const Arithmetic start = 0) {
  * @details Creates an Enumerate object. The enumerator consists of a `std::pair<IntType, value_type&>`. The
  * elements of the enumerate iterator are by reference. The `std:::pair<IntType, value_type&>::first` is the
  * counter index. The `std:::pair<IntType, value_type&>::second` is the element of the iterator by reference.
- * Furthermore, the `operator*` of this iterator returns an std::pair by value.
+ * Furthermore, the `operator*` of this iterator returns an std::pair by value. If the iterable is not random access, its
+ * length is not calculated up front, and the iterator is at most a forward iterator.
  * @tparam IntType The type of the iterator integer. By default, `int` is assumed. Can be any arithmetic type.
  * @param iterable An iterable, e.g. a container / object with `begin()` and `end()` methods.
  * @param start The start of the counting index. 0 is assumed by default.
@@ -70,8 +82,7 @@ enumerateRange(Iterator begin, Iterator end, const Arithmetic start = 0) {
 template<LZ_CONCEPT_INTEGRAL IntType = int, LZ_CONCEPT_ITERABLE Iterable>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Enumerate<internal::IterTypeFromIterable<Iterable>, IntType>
 enumerate(Iterable&& iterable, const IntType start = 0) {
-    return { internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
-             static_cast<internal::DiffTypeIterable<Iterable>>(iterable.size()), start };
+    return { internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), start };
 }
 
 // End of group
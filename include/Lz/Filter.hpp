@@ -64,11 +64,52 @@ filterRange(Iterator begin, Iterator end, UnaryPredicate predicate, Execution ex
     return { std::move(begin), std::move(end), std::move(predicate), execution };
 }
 
+namespace internal {
+// The view that `lz::filter` returns for a sequence of `Iterator`
+template<class Iterator, class UnaryPredicate, class Execution>
+struct FilterFusion {
+    using type = Filter<Iterator, UnaryPredicate, Execution>;
+
+    static LZ_CONSTEXPR_CXX_20 type make(Iterator begin, Iterator end, UnaryPredicate predicate, Execution execution) {
+        return filterRange(std::move(begin), std::move(end), std::move(predicate), execution);
+    }
+};
+
+// A sequenced filter of a sequenced filter is fused into a single filter over the underlying sequence, using the conjunction
+// of both predicates. Filters that use a parallel policy are not fused, so that their searches keep their own policy
+template<class Iterator, class Inner, class UnaryPredicate>
+struct FilterFusion<FilterIterator<Iterator, Inner, std::execution::sequenced_policy>, UnaryPredicate,
+                    std::execution::sequenced_policy> {
+    using type = Filter<Iterator, ConjunctionPredicate<Inner, UnaryPredicate>, std::execution::sequenced_policy>;
+    using InnerIterator = FilterIterator<Iterator, Inner, std::execution::sequenced_policy>;
+
+    static LZ_CONSTEXPR_CXX_20 type make(const InnerIterator& begin, const InnerIterator& end, UnaryPredicate predicate,
+                                         std::execution::sequenced_policy execution) {
+        static_assert(std::is_convertible<decltype(predicate(*begin.base())), bool>::value,
+                      "function must return type that can be converted to bool");
+        return { begin.base(), end.base(), ConjunctionPredicate<Inner, UnaryPredicate>(begin.predicate(), std::move(predicate)),
+                 execution };
+    }
+};
+} // namespace internal
+
+/**
+ * @brief Returns a forward filter iterator. If the `predicate` returns false, it is excluded. See `lz::filterRange` for more
+ * details.
+ * @details If `iterable` is a (sequenced) filter object itself, the result is a single filter object over its underlying
+ * sequence, using the conjunction of both predicates, instead of a filter of a filter.
+ * @param iterable An iterable, e.g. a container / object with `begin()` and `end()` methods.
+ * @param predicate A function that must return a bool, and needs a value type of the container as parameter.
+ * @param execPolicy The execution policy. Must be one of `std::execution`'s tags. Performs the find using this execution.
+ * @return A filter object that can be converted to an arbitrary container or can be iterated over.
+ */
 template<LZ_CONCEPT_ITERABLE Iterable, class UnaryPredicate, class Execution = std::execution::sequenced_policy>
-LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Filter<internal::IterTypeFromIterable<Iterable>, UnaryPredicate, Execution>
-filter(Iterable&& iterable, UnaryPredicate predicate, Execution execPolicy = std::execution::seq) {
-    return filterRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
-                       std::move(predicate), execPolicy);
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20
+    typename internal::FilterFusion<internal::IterTypeFromIterable<Iterable>, UnaryPredicate, Execution>::type
+    filter(Iterable&& iterable, UnaryPredicate predicate, Execution execPolicy = std::execution::seq) {
+    return internal::FilterFusion<internal::IterTypeFromIterable<Iterable>, UnaryPredicate, Execution>::make(
+        internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), std::move(predicate),
+        execPolicy);
 }
 
 #else  // ^^^ has execution vvv ! has execution
@@ -89,6 +130,31 @@ Filter<Iterator, UnaryPredicate> filterRange(Iterator begin, Iterator end, Unary
     return { std::move(begin), std::move(end), std::move(predicate) };
 }
 
+namespace internal {
+// The view that `lz::filter` returns for a sequence of `Iterator`
+template<class Iterator, class UnaryPredicate>
+struct FilterFusion {
+    using type = Filter<Iterator, UnaryPredicate>;
+
+    static type make(Iterator begin, Iterator end, UnaryPredicate predicate) {
+        return filterRange(std::move(begin), std::move(end), std::move(predicate));
+    }
+};
+
+// A filter of a filter is fused into a single filter over the underlying sequence, using the conjunction of both predicates
+template<class Iterator, class Inner, class UnaryPredicate>
+struct FilterFusion<FilterIterator<Iterator, Inner>, UnaryPredicate> {
+    using type = Filter<Iterator, ConjunctionPredicate<Inner, UnaryPredicate>>;
+
+    static type make(const FilterIterator<Iterator, Inner>& begin, const FilterIterator<Iterator, Inner>& end,
+                     UnaryPredicate predicate) {
+        static_assert(std::is_convertible<decltype(predicate(*begin.base())), bool>::value,
+                      "function return type must be convertible to a bool");
+        return { begin.base(), end.base(), ConjunctionPredicate<Inner, UnaryPredicate>(begin.predicate(), std::move(predicate)) };
+    }
+};
+} // namespace internal
+
 /**
  * @brief Returns a forward filter iterator. If the `predicate` returns false, the value it is excluded.
  * @details I.e. `lz::filter({1, 2, 3, 4, 5}, [](int i){ return i % 2 == 0; });` will eventually remove all
@@ -96,12 +162,14 @@ Filter<Iterator, UnaryPredicate> filterRange(Iterator begin, Iterator end, Unary
  * @param iterable An iterable, e.g. a container / object with `begin()` and `end()` methods.
  * @param predicate A function that must return a bool, and needs a value type of the container as parameter.
  * @return A filter iterator that can be converted to an arbitrary container or can be iterated
- * over using `for (auto... lz::filter(...))`.
+ * over using `for (auto... lz::filter(...))`. If `iterable` is a filter object itself, the result is a single filter object over
+ * its underlying sequence, using the conjunction of both predicates, instead of a filter of a filter.
  */
 template<class Iterable, class UnaryPredicate>
-Filter<internal::IterTypeFromIterable<Iterable>, UnaryPredicate> filter(Iterable&& iterable, UnaryPredicate predicate) {
-    return filterRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
-                       std::move(predicate));
+typename internal::FilterFusion<internal::IterTypeFromIterable<Iterable>, UnaryPredicate>::type
+filter(Iterable&& iterable, UnaryPredicate predicate) {
+    return internal::FilterFusion<internal::IterTypeFromIterable<Iterable>, UnaryPredicate>::make(
+        internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), std::move(predicate));
 }
 #endif // LZ_HAS_EXECUTION
 // End of group
@@ -12,9 +12,14 @@
 #    include "Zip.hpp"
 
 #    include <algorithm>
+#    include <array>
 #    include <cctype>
+#    include <climits>
+#    include <cstdint>
+#    include <cstring>
 #    include <iterator>
 #    include <numeric>
+#    include <vector>
 
 #    ifdef LZ_HAS_CXX_17
 #        define LZ_INLINE_VAR inline
@@ -64,6 +69,480 @@ template<class Fn, std::size_t... I>
 constexpr TupleExpand<Fn, I...> makeExpandFn(Fn fn, IndexSequence<I...>) {
     return TupleExpand<Fn, I...>(std::move(fn));
 }
+
+// Copies [begin, end) into a vector in a single pass, so that the sequence does not have to be walked to get its length first
+template<class Iterator>
+EnableIf<IsRandomAccess<Iterator>::value, std::vector<ValueType<Iterator>>> copyToVector(Iterator begin, Iterator end) {
+    return std::vector<ValueType<Iterator>>(std::move(begin), std::move(end));
+}
+
+template<class Iterator>
+EnableIf<!IsRandomAccess<Iterator>::value, std::vector<ValueType<Iterator>>> copyToVector(Iterator begin, Iterator end) {
+    std::vector<ValueType<Iterator>> result;
+    copyImpl(std::move(begin), std::move(end), std::back_inserter(result));
+    return result;
+}
+
+// The sorted and unique positions in a sorted sequence of `length` elements, that are needed to interpolate the quantiles `qs`
+inline std::vector<std::size_t> quantileRanks(const std::vector<double>& qs, const std::size_t length) {
+    std::vector<std::size_t> ranks;
+    ranks.reserve(qs.size() * 2);
+    for (const double q : qs) {
+        LZ_ASSERT(q >= 0 && q <= 1, "quantile must be in [0, 1]");
+        const double position = q * static_cast<double>(length - 1);
+        const auto rank = static_cast<std::size_t>(position);
+        ranks.push_back(rank);
+        if (static_cast<double>(rank) != position) {
+            ranks.push_back(rank + 1);
+        }
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+    return ranks;
+}
+
+// Linearly interpolates the `q`-quantile of [begin, begin + length), where the elements at the ranks of `quantileRanks` must be
+// in their sorted position
+template<class Iterator>
+double interpolateQuantile(const Iterator begin, const std::size_t length, const double q) {
+    using DiffType = DiffType<Iterator>;
+    const double position = q * static_cast<double>(length - 1);
+    const auto rank = static_cast<std::size_t>(position);
+    const auto lower = static_cast<double>(begin[static_cast<DiffType>(rank)]);
+    const double fraction = position - static_cast<double>(rank);
+    if (fraction == 0) {
+        return lower;
+    }
+    return lower + fraction * (static_cast<double>(begin[static_cast<DiffType>(rank + 1)]) - lower);
+}
+
+// Partially sorts [begin, end) so that the elements at the ranks [firstRank, lastRank) are in their sorted position, where
+// `offset` is the rank of `begin`. Every call to `nthElement` only partitions the segment that contains the ranks that are
+// left, so that selecting m ranks takes O(n log(m)) instead of O(n * m)
+template<class Iterator, class RankIterator, class NthElement>
+void multiSelect(Iterator begin, Iterator end, RankIterator firstRank, RankIterator lastRank, std::size_t offset,
+                 NthElement& nthElement) {
+    using DiffType = DiffType<Iterator>;
+    while (firstRank != lastRank) {
+        const RankIterator midRank = firstRank + (lastRank - firstRank) / 2;
+        const Iterator nth = begin + static_cast<DiffType>(*midRank - offset);
+        nthElement(begin, nth, end);
+        multiSelect(begin, nth, firstRank, midRank, offset, nthElement);
+        begin = nth + 1;
+        offset = *midRank + 1;
+        firstRank = midRank + 1;
+    }
+}
+} // namespace internal
+
+/**
+ * The descriptive statistics of a sequence, see `lz::stats`.
+ * @tparam T The value type of the sequence.
+ */
+template<class T>
+struct Stats {
+    //! The amount of elements.
+    std::size_t count{};
+    //! The sum of the elements.
+    T sum{};
+    //! The mean of the elements, or 0 if the sequence is empty.
+    double mean{};
+    //! The population variance of the elements, or 0 if the sequence is empty.
+    double variance{};
+    //! The smallest element, or `T{}` if the sequence is empty.
+    T min{};
+    //! The largest element, or `T{}` if the sequence is empty.
+    T max{};
+};
+
+namespace internal {
+// The state of `lz::stats`. Values are added using Welford's algorithm, and partial states (of other threads or lanes) are merged
+// using Chan's algorithm, which are both numerically stable
+template<class T>
+struct StatsAccumulator {
+    std::size_t count{};
+    T sum{};
+    double mean{};
+    double m2{};
+    T min{};
+    T max{};
+
+    void add(const T& value) {
+        if (count == 0) {
+            min = value;
+            max = value;
+        }
+        else if (value < min) {
+            min = value;
+        }
+        else if (max < value) {
+            max = value;
+        }
+        ++count;
+        sum += value;
+        const double delta = static_cast<double>(value) - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (static_cast<double>(value) - mean);
+    }
+
+    static StatsAccumulator merge(StatsAccumulator a, const StatsAccumulator& b) {
+        if (b.count == 0) {
+            return a;
+        }
+        if (a.count == 0) {
+            return b;
+        }
+        const double delta = b.mean - a.mean;
+        const auto countA = static_cast<double>(a.count);
+        const auto countB = static_cast<double>(b.count);
+        const double total = countA + countB;
+        a.mean += delta * countB / total;
+        a.m2 += b.m2 + delta * delta * countA * countB / total;
+        a.count += b.count;
+        a.sum += b.sum;
+        a.min = b.min < a.min ? b.min : a.min;
+        a.max = a.max < b.max ? b.max : a.max;
+        return a;
+    }
+
+    // The fields are set one by one, because `Stats` is not an aggregate in C++11
+    Stats<T> toStats() const {
+        Stats<T> stats;
+        stats.count = count;
+        stats.sum = sum;
+        stats.mean = mean;
+        stats.variance = count == 0 ? 0. : m2 / static_cast<double>(count);
+        stats.min = min;
+        stats.max = max;
+        return stats;
+    }
+};
+
+// The statistics of `length` contiguous arithmetic values. Instead of a division per value like Welford's algorithm, the sums of
+// the values and their squares are accumulated, shifted by the first value to avoid cancellation. Every lane has its own
+// accumulators, so that the lanes do not depend on each other and can be vectorized. The lanes are merged using Chan's algorithm
+template<class T>
+StatsAccumulator<T> contiguousStats(const T* data, const std::size_t length) {
+    constexpr std::size_t lanes = 4;
+    StatsAccumulator<T> result;
+    if (length == 0) {
+        return result;
+    }
+    const double shift = static_cast<double>(data[0]);
+    T sums[lanes]{};
+    double shiftedSums[lanes]{};
+    double squares[lanes]{};
+    T mins[lanes];
+    T maxs[lanes];
+    std::fill_n(mins, lanes, data[0]);
+    std::fill_n(maxs, lanes, data[0]);
+
+    const std::size_t vectorized = length - length % lanes;
+    for (std::size_t i = 0; i < vectorized; i += lanes) {
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            const T value = data[i + lane];
+            const double shifted = static_cast<double>(value) - shift;
+            sums[lane] += value;
+            shiftedSums[lane] += shifted;
+            squares[lane] += shifted * shifted;
+            mins[lane] = value < mins[lane] ? value : mins[lane];
+            maxs[lane] = maxs[lane] < value ? value : maxs[lane];
+        }
+    }
+    if (vectorized != 0) {
+        const std::size_t laneCount = vectorized / lanes;
+        for (std::size_t lane = 0; lane < lanes; ++lane) {
+            StatsAccumulator<T> partial;
+            partial.count = laneCount;
+            partial.sum = sums[lane];
+            partial.mean = shift + shiftedSums[lane] / static_cast<double>(laneCount);
+            const double m2 = squares[lane] - shiftedSums[lane] * shiftedSums[lane] / static_cast<double>(laneCount);
+            partial.m2 = m2 < 0 ? 0 : m2;
+            partial.min = mins[lane];
+            partial.max = maxs[lane];
+            result = StatsAccumulator<T>::merge(std::move(result), partial);
+        }
+    }
+    for (std::size_t i = vectorized; i < length; ++i) {
+        result.add(data[i]);
+    }
+    return result;
+}
+
+template<class Iterator>
+using IsContiguousArithmetic =
+    std::integral_constant<bool, IsContiguous<Iterator>::value && std::is_arithmetic<ValueType<Iterator>>::value>;
+
+template<class Iterator>
+EnableIf<IsContiguousArithmetic<Iterator>::value, StatsAccumulator<ValueType<Iterator>>> statsOf(Iterator begin, Iterator end) {
+    if (begin == end) {
+        return {};
+    }
+    return contiguousStats(std::addressof(*begin), static_cast<std::size_t>(end - begin));
+}
+
+template<class Iterator>
+EnableIf<!IsContiguousArithmetic<Iterator>::value, StatsAccumulator<ValueType<Iterator>>> statsOf(Iterator begin, Iterator end) {
+    StatsAccumulator<ValueType<Iterator>> result;
+    forEachImpl(std::move(begin), std::move(end), [&result](const ValueType<Iterator>& value) { result.add(value); });
+    return result;
+}
+
+// The `k` largest values of [begin, end), largest first. The values are kept in a heap of which the front is the smallest value
+// that is kept, so that most values only need a single comparison with the front, and only values that are larger replace it
+template<class Iterator, class Compare>
+std::vector<ValueType<Iterator>> topKHeap(Iterator begin, Iterator end, const std::size_t k, const Compare& compare) {
+    using ValueType = ValueType<Iterator>;
+    std::vector<ValueType> heap;
+    if (k == 0) {
+        return heap;
+    }
+    heap.reserve(k);
+    const auto heapCompare = [&compare](const ValueType& a, const ValueType& b) {
+        return compare(b, a);
+    };
+    forEachImpl(std::move(begin), std::move(end), [&heap, &heapCompare, &compare, k](const ValueType& value) {
+        if (heap.size() < k) {
+            heap.push_back(value);
+            std::push_heap(heap.begin(), heap.end(), heapCompare);
+        }
+        else if (compare(heap.front(), value)) {
+            std::pop_heap(heap.begin(), heap.end(), heapCompare);
+            heap.back() = value;
+            std::push_heap(heap.begin(), heap.end(), heapCompare);
+        }
+    });
+    std::sort_heap(heap.begin(), heap.end(), heapCompare);
+    return heap;
+}
+
+// If `k` is a large part of a random access sequence, the heap is replaced by copying the sequence and selecting the `k` largest
+// values using nth_element, which takes O(n) instead of O(n log(k))
+template<class Iterator, class Compare>
+EnableIf<IsRandomAccess<Iterator>::value, std::vector<ValueType<Iterator>>>
+topKOf(Iterator begin, Iterator end, const std::size_t k, const Compare& compare) {
+    using ValueType = ValueType<Iterator>;
+    const auto length = static_cast<std::size_t>(end - begin);
+    if (k < length / 8) {
+        return topKHeap(std::move(begin), std::move(end), k, compare);
+    }
+    std::vector<ValueType> result(std::move(begin), std::move(end));
+    const auto greater = [&compare](const ValueType& a, const ValueType& b) {
+        return compare(b, a);
+    };
+    const auto last = result.begin() + static_cast<DiffType<typename std::vector<ValueType>::iterator>>((std::min)(k, length));
+    std::nth_element(result.begin(), last, result.end(), greater);
+    result.erase(last, result.end());
+    std::sort(result.begin(), result.end(), greater);
+    return result;
+}
+
+template<class Iterator, class Compare>
+EnableIf<!IsRandomAccess<Iterator>::value, std::vector<ValueType<Iterator>>>
+topKOf(Iterator begin, Iterator end, const std::size_t k, const Compare& compare) {
+    return topKHeap(std::move(begin), std::move(end), k, compare);
+}
+
+// Merges two results of `topKOf` (so both are sorted largest first) into the `k` largest values of both
+template<class T, class Compare>
+std::vector<T> mergeTopK(const std::vector<T>& a, const std::vector<T>& b, const std::size_t k, const Compare& compare) {
+    std::vector<T> result;
+    result.reserve((std::min)(k, a.size() + b.size()));
+    auto first = a.begin();
+    auto second = b.begin();
+    while (result.size() < k && (first != a.end() || second != b.end())) {
+        if (second == b.end() || (first != a.end() && !compare(*first, *second))) {
+            result.push_back(*first++);
+        }
+        else {
+            result.push_back(*second++);
+        }
+    }
+    return result;
+}
+
+// Orders values by the key `keyFn` returns for them
+template<class KeyFn>
+class KeyCompare {
+    FunctionContainer<KeyFn> _keyFn;
+
+public:
+    explicit KeyCompare(KeyFn keyFn) : _keyFn(std::move(keyFn)) {
+    }
+
+    template<class T>
+    bool operator()(const T& a, const T& b) const {
+        return _keyFn(a) < _keyFn(b);
+    }
+};
+
+struct Identity {
+    template<class T>
+    constexpr T&& operator()(T&& value) const noexcept {
+        return std::forward<T>(value);
+    }
+};
+
+template<std::size_t Size>
+struct UnsignedOfSize {};
+
+template<>
+struct UnsignedOfSize<1> {
+    using type = std::uint8_t;
+};
+
+template<>
+struct UnsignedOfSize<2> {
+    using type = std::uint16_t;
+};
+
+template<>
+struct UnsignedOfSize<4> {
+    using type = std::uint32_t;
+};
+
+template<>
+struct UnsignedOfSize<8> {
+    using type = std::uint64_t;
+};
+
+template<class Key>
+using RadixType = typename UnsignedOfSize<sizeof(Key)>::type;
+
+// Keys of this type can be mapped to an unsigned integer with the same order. The values are moved between buffers during the
+// passes, which are created up front
+template<class Key, class T>
+using IsRadixSortable = std::integral_constant<bool, std::is_arithmetic<Key>::value &&
+                                                         (sizeof(Key) == 1 || sizeof(Key) == 2 || sizeof(Key) == 4 ||
+                                                          sizeof(Key) == 8) &&
+                                                         std::is_default_constructible<T>::value &&
+                                                         std::is_move_assignable<T>::value>;
+
+template<class Key>
+EnableIf<std::is_unsigned<Key>::value, RadixType<Key>> toRadix(const Key key) {
+    return static_cast<RadixType<Key>>(key);
+}
+
+// Flipping the sign bit puts the negative values before the positive ones
+template<class Key>
+EnableIf<std::is_integral<Key>::value && std::is_signed<Key>::value, RadixType<Key>> toRadix(const Key key) {
+    using Radix = RadixType<Key>;
+    return static_cast<Radix>(static_cast<Radix>(key) ^ static_cast<Radix>(Radix{ 1 } << (sizeof(Key) * CHAR_BIT - 1)));
+}
+
+// The bits of positive floats are ordered like the floats themselves, so only their sign bit is flipped, which puts them after
+// the negative floats. Negative floats are ordered in reverse, so all their bits are inverted
+template<class Key>
+EnableIf<std::is_floating_point<Key>::value, RadixType<Key>> toRadix(const Key key) {
+    using Radix = RadixType<Key>;
+    Radix bits;
+    std::memcpy(&bits, &key, sizeof(Key));
+    const auto signBit = static_cast<Radix>(Radix{ 1 } << (sizeof(Key) * CHAR_BIT - 1));
+    return (bits & signBit) != 0 ? static_cast<Radix>(~bits) : static_cast<Radix>(bits | signBit);
+}
+
+template<class Radix, class T>
+struct KeyedValue {
+    Radix key;
+    T value;
+};
+
+template<class Radix, class T>
+bool operator<(const KeyedValue<Radix, T>& a, const KeyedValue<Radix, T>& b) {
+    return a.key < b.key;
+}
+
+// Only random access sequences are reserved for, because getting the length of other sequences takes an extra pass
+template<class T, class Iterator>
+EnableIf<IsRandomAccess<Iterator>::value> reserveFor(std::vector<T>& vector, const Iterator& begin, const Iterator& end) {
+    const auto length = end - begin;
+    if (length > 0) {
+        vector.reserve(static_cast<std::size_t>(length));
+    }
+}
+
+template<class T, class Iterator>
+EnableIf<!IsRandomAccess<Iterator>::value> reserveFor(std::vector<T>&, const Iterator&, const Iterator&) {
+}
+
+// Copies [begin, end) together with the keys, so that `keyFn` is only called once for every element
+template<class Iterator, class KeyFn, class Key = Decay<FunctionReturnType<KeyFn, RefType<Iterator>>>>
+std::vector<KeyedValue<RadixType<Key>, ValueType<Iterator>>> keyedValues(Iterator begin, Iterator end, KeyFn& keyFn) {
+    using Item = KeyedValue<RadixType<Key>, ValueType<Iterator>>;
+    std::vector<Item> items;
+    reserveFor(items, begin, end);
+    forEachImpl(std::move(begin), std::move(end), [&items, &keyFn](const ValueType<Iterator>& value) {
+        items.push_back(Item{ toRadix(static_cast<Key>(keyFn(value))), value });
+    });
+    return items;
+}
+
+// Sorts [first, last) by key using a stable LSD radix sort of a byte per pass, where `scratch` has the same length. The
+// histograms of all bytes are calculated in a single pass, and the passes of which all keys have the same byte are skipped
+template<class Radix, class T>
+void radixSort(KeyedValue<Radix, T>* first, KeyedValue<Radix, T>* last, KeyedValue<Radix, T>* scratch) {
+    constexpr std::size_t buckets = 256;
+    const auto length = static_cast<std::size_t>(last - first);
+    if (length < buckets) {
+        std::stable_sort(first, last);
+        return;
+    }
+    std::array<std::array<std::size_t, buckets>, sizeof(Radix)> counts{};
+    for (const KeyedValue<Radix, T>* item = first; item != last; ++item) {
+        for (std::size_t pass = 0; pass < sizeof(Radix); ++pass) {
+            ++counts[pass][(item->key >> (pass * CHAR_BIT)) & 0xFF];
+        }
+    }
+    KeyedValue<Radix, T>* source = first;
+    KeyedValue<Radix, T>* target = scratch;
+    for (std::size_t pass = 0; pass < sizeof(Radix); ++pass) {
+        const std::size_t shift = pass * CHAR_BIT;
+        std::array<std::size_t, buckets>& offsets = counts[pass];
+        if (offsets[(source->key >> shift) & 0xFF] == length) {
+            continue;
+        }
+        std::size_t offset = 0;
+        for (std::size_t& count : offsets) {
+            const std::size_t bucketLength = count;
+            count = offset;
+            offset += bucketLength;
+        }
+        for (KeyedValue<Radix, T>* item = source; item != source + length; ++item) {
+            target[offsets[(item->key >> shift) & 0xFF]++] = std::move(*item);
+        }
+        std::swap(source, target);
+    }
+    if (source != first) {
+        std::move(source, source + length, first);
+    }
+}
+
+template<class Radix, class T>
+std::vector<T> valuesOf(std::vector<KeyedValue<Radix, T>>& items) {
+    std::vector<T> values;
+    values.reserve(items.size());
+    for (KeyedValue<Radix, T>& item : items) {
+        values.push_back(std::move(item.value));
+    }
+    return values;
+}
+
+template<class Iterator, class KeyFn, class Key = Decay<FunctionReturnType<KeyFn, RefType<Iterator>>>>
+EnableIf<IsRadixSortable<Key, ValueType<Iterator>>::value, std::vector<ValueType<Iterator>>>
+sortedVector(Iterator begin, Iterator end, KeyFn& keyFn) {
+    auto items = keyedValues(std::move(begin), std::move(end), keyFn);
+    decltype(items) scratch(items.size());
+    radixSort(items.data(), items.data() + items.size(), scratch.data());
+    return valuesOf(items);
+}
+
+template<class Iterator, class KeyFn, class Key = Decay<FunctionReturnType<KeyFn, RefType<Iterator>>>>
+EnableIf<!IsRadixSortable<Key, ValueType<Iterator>>::value, std::vector<ValueType<Iterator>>>
+sortedVector(Iterator begin, Iterator end, KeyFn& keyFn) {
+    auto values = copyToVector(std::move(begin), std::move(end));
+    std::stable_sort(values.begin(), values.end(), KeyCompare<std::reference_wrapper<KeyFn>>(std::ref(keyFn)));
+    return values;
+}
 } // namespace internal
 
 /**
@@ -392,7 +871,8 @@ mean(Iterator begin, Iterator end, BinaryOp binaryOp = {}, Execution execution =
     ValueType sum;
     if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
-        sum = std::reduce(begin, end, ValueType{ 0 }, std::move(binaryOp));
+        using internal::foldlImpl;
+        sum = foldlImpl(begin, end, ValueType{ 0 }, std::move(binaryOp));
     }
     else {
         sum = std::reduce(execution, begin, end, ValueType{ 0 }, std::move(binaryOp));
@@ -412,6 +892,67 @@ mean(const Iterable& iterable, BinaryOp binOp = {}, Execution execution = std::e
     return mean(std::begin(iterable), std::end(iterable), std::move(binOp), execution);
 }
 
+/**
+ * Gets the count, sum, mean, variance, minimum and maximum of a sequence, in a single pass over the sequence. Lazy views, for
+ * e.g. a `lz::map` or `lz::filter` view, are therefore only evaluated once. The mean and variance are calculated using Welford's
+ * algorithm. Contiguous arithmetic sequences (pointers, `std::vector`, `std::string`, ...) use a faster kernel that accumulates
+ * multiple lanes independently. If a parallel policy is used, random access sequences are split into chunks of which the
+ * statistics are calculated per thread and then merged using Chan's algorithm.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param execution The execution policy.
+ * @return The statistics of the sequence.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Execution = std::execution::sequenced_policy>
+LZ_NODISCARD Stats<internal::ValueType<Iterator>> stats(Iterator begin, Iterator end, Execution execution = std::execution::seq) {
+    using ValueType = internal::ValueType<Iterator>;
+    using Accumulator = internal::StatsAccumulator<ValueType>;
+    const auto merge = [](const Accumulator& a, const Accumulator& b) { return Accumulator::merge(a, b); };
+
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
+        static_cast<void>(execution);
+        static_cast<void>(merge);
+        return internal::statsOf(std::move(begin), std::move(end)).toStats();
+    }
+    else if constexpr (internal::IsRandomAccess<Iterator>::value) {
+        using DiffType = internal::DiffType<Iterator>;
+        const auto length = static_cast<std::size_t>(end - begin);
+        constexpr std::size_t chunkLength = 1 << 14;
+        std::vector<std::size_t> chunks((length + chunkLength - 1) / chunkLength);
+        std::iota(chunks.begin(), chunks.end(), std::size_t{ 0 });
+        return std::transform_reduce(execution, chunks.begin(), chunks.end(), Accumulator{}, merge,
+                                     [&begin, length](const std::size_t chunk) {
+                                         const std::size_t first = chunk * chunkLength;
+                                         const std::size_t last = (std::min)(first + chunkLength, length);
+                                         return internal::statsOf(begin + static_cast<DiffType>(first),
+                                                                  begin + static_cast<DiffType>(last));
+                                     })
+            .toStats();
+    }
+    else {
+        return std::transform_reduce(execution, std::move(begin), std::move(end), Accumulator{}, merge,
+                                     [](const ValueType& value) {
+                                         Accumulator accumulator;
+                                         accumulator.add(value);
+                                         return accumulator;
+                                     })
+            .toStats();
+    }
+}
+
+/**
+ * Gets the count, sum, mean, variance, minimum and maximum of a sequence, in a single pass over the sequence. See `lz::stats`
+ * for more details.
+ * @param iterable The sequence to get the statistics of.
+ * @param execution The execution policy.
+ * @return The statistics of the sequence.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Execution = std::execution::sequenced_policy,
+         class Iterator = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD Stats<internal::ValueType<Iterator>> stats(Iterable&& iterable, Execution execution = std::execution::seq) {
+    return stats(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), execution);
+}
+
 /**
  * Creates a map object with filter iterator that, if the filter function returns true, the map function is executed.
  * @param begin The beginning of the sequence.
@@ -577,28 +1118,22 @@ median(Iterator begin, Iterator end, Comparer comparer = {}, Execution execution
     using lz::next;
     using std::next;
     const internal::DiffType<Iterator> len = internal::getIterLength(begin, end);
-    constexpr bool isSequenced = internal::checkForwardAndPolicies<Execution, Iterator>();
     LZ_ASSERT(len > 0, "the length of the sequence cannot be 0");
-    const internal::DiffType<Iterator> mid = len / 2;
-    const Iterator midIter = next(begin, mid);
-    if constexpr (isSequenced) {
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
-        std::nth_element(begin, midIter, end, comparer);
+        using internal::medianImpl;
+        return medianImpl(std::move(begin), std::move(end), std::move(comparer));
     }
     else {
+        const internal::DiffType<Iterator> mid = len / 2;
+        const Iterator midIter = next(begin, mid);
         std::nth_element(execution, begin, midIter, end, comparer);
-    }
-    if (internal::isEven(len)) {
-        if constexpr (isSequenced) {
-            const Iterator leftHalf = std::max_element(begin, midIter, comparer);
-            return (static_cast<double>(*leftHalf) + *midIter) / 2.;
-        }
-        else {
+        if (internal::isEven(len)) {
             const Iterator leftHalf = std::max_element(execution, begin, midIter, comparer);
             return (static_cast<double>(*leftHalf) + *midIter) / 2.;
         }
+        return *midIter;
     }
-    return *midIter;
 }
 
 /**
@@ -615,6 +1150,248 @@ median(Iterable& iterable, Comparer comparer = {}, Execution execution = std::ex
     return median(std::begin(iterable), std::end(iterable), std::move(comparer), execution);
 }
 
+/**
+ * Gets multiple quantiles of a random access sequence at once, by partially sorting the sequence in place. This can be used to
+ * reuse a buffer for multiple calls. The quantiles are linearly interpolated between the two closest elements, so that the
+ * 0.5 quantile is equal to the median. Each step of the selection only partitions the part of the sequence that contains the
+ * remaining ranks, so getting m quantiles takes O(n log(m)) instead of m calls to nth_element over the whole sequence.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param qs The quantiles to get, each in [0, 1], for e.g. `{ 0.5, 0.9, 0.99 }`.
+ * @param comparer The comparer used to order the elements.
+ * @param execution Uses the execution to perform the nth_element algorithm.
+ * @return The quantiles, in the same order as `qs`. If the sequence is empty, all quantiles are 0.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class Comparer = std::less<>>
+LZ_NODISCARD std::vector<double> quantilesInPlace(Iterator begin, Iterator end, const std::vector<double>& qs,
+                                                  Comparer comparer = {}, Execution execution = std::execution::seq) {
+    static_assert(internal::IsRandomAccess<Iterator>::value, "the iterator must be random access, use lz::quantiles instead");
+    const auto length = static_cast<std::size_t>(end - begin);
+    if (length == 0) {
+        return std::vector<double>(qs.size(), 0.);
+    }
+    const std::vector<std::size_t> ranks = internal::quantileRanks(qs, length);
+    if constexpr (internal::IsSequencedPolicyV<Execution>) {
+        static_cast<void>(execution);
+        auto nthElement = [&comparer](Iterator first, Iterator nth, Iterator last) {
+            std::nth_element(first, nth, last, comparer);
+        };
+        internal::multiSelect(begin, end, ranks.begin(), ranks.end(), 0, nthElement);
+    }
+    else {
+        auto nthElement = [&comparer, &execution](Iterator first, Iterator nth, Iterator last) {
+            std::nth_element(execution, first, nth, last, comparer);
+        };
+        internal::multiSelect(begin, end, ranks.begin(), ranks.end(), 0, nthElement);
+    }
+    std::vector<double> result;
+    result.reserve(qs.size());
+    for (const double q : qs) {
+        result.push_back(internal::interpolateQuantile(begin, length, q));
+    }
+    return result;
+}
+
+/**
+ * Gets multiple quantiles of a sequence at once. The sequence is copied once into a buffer, and is not modified, so any view
+ * can be used. See `lz::quantilesInPlace` for more details.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param qs The quantiles to get, each in [0, 1], for e.g. `{ 0.5, 0.9, 0.99 }`.
+ * @param comparer The comparer used to order the elements.
+ * @param execution Uses the execution to perform the nth_element algorithm.
+ * @return The quantiles, in the same order as `qs`. If the sequence is empty, all quantiles are 0.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class Comparer = std::less<>>
+LZ_NODISCARD std::vector<double> quantiles(Iterator begin, Iterator end, const std::vector<double>& qs, Comparer comparer = {},
+                                           Execution execution = std::execution::seq) {
+    auto buffer = internal::copyToVector(std::move(begin), std::move(end));
+    return quantilesInPlace(buffer.begin(), buffer.end(), qs, std::move(comparer), execution);
+}
+
+/**
+ * Gets multiple quantiles of a sequence at once. The sequence is copied once into a buffer, and is not modified, so any view
+ * can be used. See `lz::quantilesInPlace` for more details.
+ * @param iterable The sequence to get the quantiles of.
+ * @param qs The quantiles to get, each in [0, 1], for e.g. `{ 0.5, 0.9, 0.99 }`.
+ * @param comparer The comparer used to order the elements.
+ * @param execution Uses the execution to perform the nth_element algorithm.
+ * @return The quantiles, in the same order as `qs`. If the sequence is empty, all quantiles are 0.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class Comparer = std::less<>>
+LZ_NODISCARD std::vector<double>
+quantiles(Iterable&& iterable, const std::vector<double>& qs, Comparer comparer = {}, Execution execution = std::execution::seq) {
+    return quantiles(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), qs,
+                     std::move(comparer), execution);
+}
+
+/**
+ * Gets the `k` largest elements of a sequence, largest first, in a single pass. Only the `k` largest elements seen so far are
+ * kept in a heap, so that the sequence does not have to be copied and sorted. If `k` is a large part of a random access
+ * sequence, the sequence is copied once and the elements are selected using nth_element instead. Use `std::greater<>` to get the
+ * `k` smallest elements. If a parallel policy is used, random access sequences are split into chunks of which the `k`
+ * largest elements are selected per thread and then merged. Other sequences are always traversed sequentially.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param comparer The comparer used to order the elements.
+ * @param execution The execution policy.
+ * @return The `min(k, length)` largest elements, sorted from largest to smallest.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class Comparer = std::less<>>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+topK(Iterator begin, Iterator end, const std::size_t k, Comparer comparer = {}, Execution execution = std::execution::seq) {
+    using ValueType = internal::ValueType<Iterator>;
+    if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>() || !internal::IsRandomAccess<Iterator>::value) {
+        static_cast<void>(execution);
+        return internal::topKOf(std::move(begin), std::move(end), k, comparer);
+    }
+    else {
+        using DiffType = internal::DiffType<Iterator>;
+        constexpr std::size_t chunkLength = 1 << 16;
+        const auto length = static_cast<std::size_t>(end - begin);
+        std::vector<std::size_t> chunks((length + chunkLength - 1) / chunkLength);
+        std::iota(chunks.begin(), chunks.end(), std::size_t{ 0 });
+        return std::transform_reduce(
+            execution, chunks.begin(), chunks.end(), std::vector<ValueType>(),
+            [k, &comparer](const std::vector<ValueType>& a, const std::vector<ValueType>& b) {
+                return internal::mergeTopK(a, b, k, comparer);
+            },
+            [&begin, length, k, &comparer](const std::size_t chunk) {
+                const std::size_t first = chunk * chunkLength;
+                const std::size_t last = (std::min)(first + chunkLength, length);
+                return internal::topKOf(begin + static_cast<DiffType>(first), begin + static_cast<DiffType>(last), k, comparer);
+            });
+    }
+}
+
+/**
+ * Gets the `k` largest elements of a sequence, largest first, in a single pass. See `lz::topK` for more details.
+ * @param iterable The sequence to get the largest elements of.
+ * @param k The amount of elements to get.
+ * @param comparer The comparer used to order the elements.
+ * @param execution The execution policy.
+ * @return The `min(k, length)` largest elements, sorted from largest to smallest.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class Comparer = std::less<>,
+         class Iterator = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+topK(Iterable&& iterable, const std::size_t k, Comparer comparer = {}, Execution execution = std::execution::seq) {
+    return topK(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), k,
+                std::move(comparer), execution);
+}
+
+/**
+ * Gets the `k` elements with the largest keys of a sequence, largest first, in a single pass. See `lz::topK` for more details.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param keyFn Returns the key of an element, the keys are compared using `operator<`.
+ * @param execution The execution policy.
+ * @return The `min(k, length)` elements with the largest keys, sorted from largest to smallest key.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class KeyFn>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+topKBy(Iterator begin, Iterator end, const std::size_t k, KeyFn keyFn, Execution execution = std::execution::seq) {
+    return topK(std::move(begin), std::move(end), k, internal::KeyCompare<KeyFn>(std::move(keyFn)), execution);
+}
+
+/**
+ * Gets the `k` elements with the largest keys of a sequence, largest first, in a single pass. See `lz::topK` for more details.
+ * @param iterable The sequence to get the elements of.
+ * @param k The amount of elements to get.
+ * @param keyFn Returns the key of an element, the keys are compared using `operator<`.
+ * @param execution The execution policy.
+ * @return The `min(k, length)` elements with the largest keys, sorted from largest to smallest key.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class KeyFn,
+         class Iterator = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+topKBy(Iterable&& iterable, const std::size_t k, KeyFn keyFn, Execution execution = std::execution::seq) {
+    return topKBy(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), k,
+                  std::move(keyFn), execution);
+}
+
+/**
+ * Copies a sequence into a `std::vector` and sorts it by the keys `keyFn` returns, in a single pass over the sequence. If the
+ * keys are integral or floating point numbers, `keyFn` is only called once for every element, and the elements are sorted using
+ * a stable LSD radix sort, which takes O(n) instead of O(n log(n)). Other keys are sorted using `std::stable_sort` and
+ * `operator<`, which calls `keyFn` for both elements of every comparison. Elements with equal keys keep their order. The
+ * result can be used for the views that need sorted input, for e.g. `lz::joinWhere`, `lz::except` or `lz::unique`. If a
+ * parallel policy is used, the sequence is still copied sequentially, after which chunks are sorted per thread and merged in
+ * parallel.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param keyFn Returns the key of an element, by default the element itself.
+ * @param execution The execution policy.
+ * @return The elements of the sequence, sorted by their keys.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERATOR Iterator, class KeyFn = internal::Identity>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+toSortedVector(Iterator begin, Iterator end, KeyFn keyFn = {}, Execution execution = std::execution::seq) {
+    using ValueType = internal::ValueType<Iterator>;
+    using Key = internal::Decay<internal::FunctionReturnType<KeyFn, internal::RefType<Iterator>>>;
+
+    if constexpr (internal::IsSequencedPolicyV<Execution>) {
+        static_cast<void>(execution);
+        return internal::sortedVector(std::move(begin), std::move(end), keyFn);
+    }
+    else if constexpr (internal::IsRadixSortable<Key, ValueType>::value) {
+        constexpr std::size_t chunkLength = 1 << 16;
+        auto items = internal::keyedValues(std::move(begin), std::move(end), keyFn);
+        decltype(items) scratch(items.size());
+        using Item = typename decltype(items)::value_type;
+        Item* source = items.data();
+        Item* target = scratch.data();
+        const std::size_t length = items.size();
+
+        std::vector<std::size_t> chunks((length + chunkLength - 1) / chunkLength);
+        std::iota(chunks.begin(), chunks.end(), std::size_t{ 0 });
+        std::for_each(execution, chunks.begin(), chunks.end(), [source, target, length](const std::size_t chunk) {
+            const std::size_t first = chunk * chunkLength;
+            const std::size_t last = (std::min)(first + chunkLength, length);
+            internal::radixSort(source + first, source + last, target + first);
+        });
+        // Merges pairs of sorted runs, of which the length doubles every round
+        for (std::size_t width = chunkLength; width < length; width *= 2) {
+            chunks.resize((length + 2 * width - 1) / (2 * width));
+            std::for_each(execution, chunks.begin(), chunks.end(), [source, target, length, width](const std::size_t pair) {
+                const std::size_t first = (std::min)(pair * 2 * width, length);
+                const std::size_t middle = (std::min)(first + width, length);
+                const std::size_t last = (std::min)(middle + width, length);
+                std::merge(std::make_move_iterator(source + first), std::make_move_iterator(source + middle),
+                           std::make_move_iterator(source + middle), std::make_move_iterator(source + last), target + first);
+            });
+            std::swap(source, target);
+        }
+        if (source != items.data()) {
+            items.swap(scratch);
+        }
+        return internal::valuesOf(items);
+    }
+    else {
+        auto values = internal::copyToVector(std::move(begin), std::move(end));
+        std::stable_sort(execution, values.begin(), values.end(), internal::KeyCompare<KeyFn>(std::move(keyFn)));
+        return values;
+    }
+}
+
+/**
+ * Copies a sequence into a `std::vector` and sorts it by the keys `keyFn` returns, in a single pass over the sequence. See
+ * `lz::toSortedVector` for more details.
+ * @param iterable The sequence to sort.
+ * @param keyFn Returns the key of an element, by default the element itself.
+ * @param execution The execution policy.
+ * @return The elements of the sequence, sorted by their keys.
+ */
+template<class Execution = std::execution::sequenced_policy, LZ_CONCEPT_ITERABLE Iterable, class KeyFn = internal::Identity,
+         class Iterator = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+toSortedVector(Iterable&& iterable, KeyFn keyFn = {}, Execution execution = std::execution::seq) {
+    return toSortedVector(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                          std::move(keyFn), execution);
+}
+
 /**
  * Checks if `toFind` is in the sequence [begin, end). If so, it returns `toFind`, otherwise it returns `defaultValue`.
  * @param begin The beginning of the sequence.
@@ -776,7 +1553,8 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 std::size_t
 indexOf(Iterator begin, Iterator end, const T& val, Execution execution = std::execution::seq) {
     if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
-        const Iterator pos = std::find(begin, end, val);
+        using internal::findImpl;
+        const Iterator pos = findImpl(begin, end, val);
         return pos == end ? npos : static_cast<std::size_t>(internal::getIterLength(begin, pos));
     }
     else {
@@ -939,7 +1717,8 @@ template<class Iterator, class BinaryOp = std::plus<>>
 double mean(Iterator begin, Iterator end, BinaryOp binOp = {}) {
     using ValueType = internal::ValueType<Iterator>;
     const internal::DiffType<Iterator> dist = internal::getIterLength(begin, end);
-    const ValueType sum = std::accumulate(begin, end, ValueType{ 0 }, std::move(binOp));
+    using internal::foldlImpl;
+    const ValueType sum = foldlImpl(begin, end, ValueType{ 0 }, std::move(binOp));
     return static_cast<double>(sum) / dist;
 }
 
@@ -957,6 +1736,31 @@ double mean(const Iterable& iterable, BinaryOp binOp = {}) {
     return mean(std::begin(iterable), std::end(iterable), std::move(binOp));
 }
 
+/**
+ * Gets the count, sum, mean, variance, minimum and maximum of a sequence, in a single pass over the sequence. Lazy views, for
+ * e.g. a `lz::map` or `lz::filter` view, are therefore only evaluated once. The mean and variance are calculated using Welford's
+ * algorithm. Contiguous arithmetic sequences (pointers, `std::vector`, `std::string`, ...) use a faster kernel that accumulates
+ * multiple lanes independently.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @return The statistics of the sequence.
+ */
+template<class Iterator>
+Stats<internal::ValueType<Iterator>> stats(Iterator begin, Iterator end) {
+    return internal::statsOf(std::move(begin), std::move(end)).toStats();
+}
+
+/**
+ * Gets the count, sum, mean, variance, minimum and maximum of a sequence, in a single pass over the sequence. See `lz::stats`
+ * for more details.
+ * @param iterable The sequence to get the statistics of.
+ * @return The statistics of the sequence.
+ */
+template<class Iterable, class Iterator = internal::IterTypeFromIterable<Iterable>>
+Stats<internal::ValueType<Iterator>> stats(Iterable&& iterable) {
+    return stats(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
+}
+
 /**
  * Gets the median of a sequence.
  * @param begin The beginning of the sequence
@@ -971,20 +1775,11 @@ template<class Iterator, class Comparer = std::less<internal::ValueType<Iterator
 template<class Iterator, class Comparer = std::less<>>
 #        endif // LZ_HAS_CXX_11
 double median(Iterator begin, Iterator end, Comparer comparer = {}) {
-    using lz::next;
-    using std::next;
-    const internal::DiffType<Iterator> len = internal::getIterLength(begin, end);
-    if (len == 0) {
+    if (internal::getIterLength(begin, end) == 0) {
         return 0.;
     }
-    const internal::DiffType<Iterator> mid = len >> 1;
-    const Iterator midIter = next(begin, mid);
-    std::nth_element(begin, midIter, end, comparer);
-    if (internal::isEven(len)) {
-        const Iterator leftHalf = std::max_element(begin, midIter, comparer);
-        return (static_cast<double>(*leftHalf) + *midIter) / 2.;
-    }
-    return *midIter;
+    using internal::medianImpl;
+    return medianImpl(std::move(begin), std::move(end), std::move(comparer));
 }
 
 /**
@@ -1003,6 +1798,170 @@ double median(Iterable& iterable, Comparer comparer = {}) {
     return median(std::begin(iterable), std::end(iterable), std::move(comparer));
 }
 
+/**
+ * Gets multiple quantiles of a random access sequence at once, by partially sorting the sequence in place. This can be used to
+ * reuse a buffer for multiple calls. The quantiles are linearly interpolated between the two closest elements, so that the
+ * 0.5 quantile is equal to the median. Each step of the selection only partitions the part of the sequence that contains the
+ * remaining ranks, so getting m quantiles takes O(n log(m)) instead of m calls to nth_element over the whole sequence.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param qs The quantiles to get, each in [0, 1], for e.g. `{ 0.5, 0.9, 0.99 }`.
+ * @param comparer The comparer used to order the elements.
+ * @return The quantiles, in the same order as `qs`. If the sequence is empty, all quantiles are 0.
+ */
+#        ifdef LZ_HAS_CXX_11
+template<class Iterator, class Comparer = std::less<internal::ValueType<Iterator>>>
+#        else
+template<class Iterator, class Comparer = std::less<>>
+#        endif // LZ_HAS_CXX_11
+std::vector<double> quantilesInPlace(Iterator begin, Iterator end, const std::vector<double>& qs, Comparer comparer = {}) {
+    static_assert(internal::IsRandomAccess<Iterator>::value, "the iterator must be random access, use lz::quantiles instead");
+    const auto length = static_cast<std::size_t>(end - begin);
+    if (length == 0) {
+        return std::vector<double>(qs.size(), 0.);
+    }
+    const std::vector<std::size_t> ranks = internal::quantileRanks(qs, length);
+    auto nthElement = [&comparer](Iterator first, Iterator nth, Iterator last) { std::nth_element(first, nth, last, comparer); };
+    internal::multiSelect(begin, end, ranks.begin(), ranks.end(), 0, nthElement);
+
+    std::vector<double> result;
+    result.reserve(qs.size());
+    for (const double q : qs) {
+        result.push_back(internal::interpolateQuantile(begin, length, q));
+    }
+    return result;
+}
+
+/**
+ * Gets multiple quantiles of a sequence at once. The sequence is copied once into a buffer, and is not modified, so any view
+ * can be used. See `lz::quantilesInPlace` for more details.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param qs The quantiles to get, each in [0, 1], for e.g. `{ 0.5, 0.9, 0.99 }`.
+ * @param comparer The comparer used to order the elements.
+ * @return The quantiles, in the same order as `qs`. If the sequence is empty, all quantiles are 0.
+ */
+#        ifdef LZ_HAS_CXX_11
+template<class Iterator, class Comparer = std::less<internal::ValueType<Iterator>>>
+#        else
+template<class Iterator, class Comparer = std::less<>>
+#        endif // LZ_HAS_CXX_11
+std::vector<double> quantiles(Iterator begin, Iterator end, const std::vector<double>& qs, Comparer comparer = {}) {
+    auto buffer = internal::copyToVector(std::move(begin), std::move(end));
+    return quantilesInPlace(buffer.begin(), buffer.end(), qs, std::move(comparer));
+}
+
+/**
+ * Gets multiple quantiles of a sequence at once. The sequence is copied once into a buffer, and is not modified, so any view
+ * can be used. See `lz::quantilesInPlace` for more details.
+ * @param iterable The sequence to get the quantiles of.
+ * @param qs The quantiles to get, each in [0, 1], for e.g. `{ 0.5, 0.9, 0.99 }`.
+ * @param comparer The comparer used to order the elements.
+ * @return The quantiles, in the same order as `qs`. If the sequence is empty, all quantiles are 0.
+ */
+#        ifdef LZ_HAS_CXX_11
+template<class Iterable, class Comparer = std::less<internal::ValueTypeIterable<Iterable>>>
+#        else
+template<class Iterable, class Comparer = std::less<>>
+#        endif // LZ_HAS_CXX_11
+std::vector<double> quantiles(Iterable&& iterable, const std::vector<double>& qs, Comparer comparer = {}) {
+    return quantiles(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), qs,
+                     std::move(comparer));
+}
+
+/**
+ * Gets the `k` largest elements of a sequence, largest first, in a single pass. Only the `k` largest elements seen so far are
+ * kept in a heap, so that the sequence does not have to be copied and sorted. If `k` is a large part of a random access
+ * sequence, the sequence is copied once and the elements are selected using nth_element instead. Use `std::greater<>` to get the
+ * `k` smallest elements.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param comparer The comparer used to order the elements.
+ * @return The `min(k, length)` largest elements, sorted from largest to smallest.
+ */
+#        ifdef LZ_HAS_CXX_11
+template<class Iterator, class Comparer = std::less<internal::ValueType<Iterator>>>
+#        else
+template<class Iterator, class Comparer = std::less<>>
+#        endif // LZ_HAS_CXX_11
+std::vector<internal::ValueType<Iterator>> topK(Iterator begin, Iterator end, const std::size_t k, Comparer comparer = {}) {
+    return internal::topKOf(std::move(begin), std::move(end), k, comparer);
+}
+
+/**
+ * Gets the `k` largest elements of a sequence, largest first, in a single pass. See `lz::topK` for more details.
+ * @param iterable The sequence to get the largest elements of.
+ * @param k The amount of elements to get.
+ * @param comparer The comparer used to order the elements.
+ * @return The `min(k, length)` largest elements, sorted from largest to smallest.
+ */
+#        ifdef LZ_HAS_CXX_11
+template<class Iterable, class Comparer = std::less<internal::ValueTypeIterable<Iterable>>,
+         class Iterator = internal::IterTypeFromIterable<Iterable>>
+#        else
+template<class Iterable, class Comparer = std::less<>, class Iterator = internal::IterTypeFromIterable<Iterable>>
+#        endif // LZ_HAS_CXX_11
+std::vector<internal::ValueType<Iterator>> topK(Iterable&& iterable, const std::size_t k, Comparer comparer = {}) {
+    return topK(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), k,
+                std::move(comparer));
+}
+
+/**
+ * Gets the `k` elements with the largest keys of a sequence, largest first, in a single pass. See `lz::topK` for more details.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The amount of elements to get.
+ * @param keyFn Returns the key of an element, the keys are compared using `operator<`.
+ * @return The `min(k, length)` elements with the largest keys, sorted from largest to smallest key.
+ */
+template<class Iterator, class KeyFn>
+std::vector<internal::ValueType<Iterator>> topKBy(Iterator begin, Iterator end, const std::size_t k, KeyFn keyFn) {
+    return topK(std::move(begin), std::move(end), k, internal::KeyCompare<KeyFn>(std::move(keyFn)));
+}
+
+/**
+ * Gets the `k` elements with the largest keys of a sequence, largest first, in a single pass. See `lz::topK` for more details.
+ * @param iterable The sequence to get the elements of.
+ * @param k The amount of elements to get.
+ * @param keyFn Returns the key of an element, the keys are compared using `operator<`.
+ * @return The `min(k, length)` elements with the largest keys, sorted from largest to smallest key.
+ */
+template<class Iterable, class KeyFn, class Iterator = internal::IterTypeFromIterable<Iterable>>
+std::vector<internal::ValueType<Iterator>> topKBy(Iterable&& iterable, const std::size_t k, KeyFn keyFn) {
+    return topKBy(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), k,
+                  std::move(keyFn));
+}
+
+/**
+ * Copies a sequence into a `std::vector` and sorts it by the keys `keyFn` returns, in a single pass over the sequence. If the
+ * keys are integral or floating point numbers, `keyFn` is only called once for every element, and the elements are sorted using
+ * a stable LSD radix sort, which takes O(n) instead of O(n log(n)). Other keys are sorted using `std::stable_sort` and
+ * `operator<`, which calls `keyFn` for both elements of every comparison. Elements with equal keys keep their order. The
+ * result can be used for the views that need sorted input, for e.g. `lz::joinWhere`, `lz::except` or `lz::unique`.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param keyFn Returns the key of an element, by default the element itself.
+ * @return The elements of the sequence, sorted by their keys.
+ */
+template<class Iterator, class KeyFn = internal::Identity>
+std::vector<internal::ValueType<Iterator>> toSortedVector(Iterator begin, Iterator end, KeyFn keyFn = {}) {
+    return internal::sortedVector(std::move(begin), std::move(end), keyFn);
+}
+
+/**
+ * Copies a sequence into a `std::vector` and sorts it by the keys `keyFn` returns, in a single pass over the sequence. See
+ * `lz::toSortedVector` for more details.
+ * @param iterable The sequence to sort.
+ * @param keyFn Returns the key of an element, by default the element itself.
+ * @return The elements of the sequence, sorted by their keys.
+ */
+template<class Iterable, class KeyFn = internal::Identity, class Iterator = internal::IterTypeFromIterable<Iterable>>
+std::vector<internal::ValueType<Iterator>> toSortedVector(Iterable&& iterable, KeyFn keyFn = {}) {
+    return toSortedVector(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                          std::move(keyFn));
+}
+
 /**
  * Checks if `toFind` is in the sequence [begin, end). If so, it returns `toFind`, otherwise it returns `defaultValue`.
  * @param begin The beginning of the sequence.
@@ -1129,7 +2088,8 @@ findLastOrDefaultIf(const Iterable& iterable, UnaryPredicate predicate, const T&
  */
 template<class Iterator, class T>
 std::size_t indexOf(Iterator begin, Iterator end, const T& val) {
-    const Iterator pos = std::find(begin, end, val);
+    using internal::findImpl;
+    const Iterator pos = findImpl(begin, end, val);
     return pos == end ? npos : static_cast<std::size_t>(internal::getIterLength(begin, pos));
 }
 
@@ -1178,7 +2138,8 @@ std::size_t indexOfIf(const Iterable& iterable, UnaryFunc predicate) {
  */
 template<class Iterator, class T>
 bool contains(Iterator begin, Iterator end, const T& value) {
-    return std::find(std::move(begin), end, value) != end;
+    using internal::findImpl;
+    return findImpl(std::move(begin), end, value) != end;
 }
 
 /**
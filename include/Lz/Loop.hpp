@@ -7,10 +7,13 @@
 #    include "detail/LoopIterator.hpp"
 
 namespace lz {
+template<class Iterator, bool /* isInfinite */>
+class Loop;
+
 template<class Iterator>
-class Loop final : public internal::BasicIteratorView<internal::LoopIterator<Iterator>> {
+class Loop<Iterator, true> final : public internal::BasicIteratorView<internal::LoopIterator<Iterator, true>> {
 public:
-    using iterator = internal::LoopIterator<Iterator>;
+    using iterator = internal::LoopIterator<Iterator, true>;
     using const_iterator = iterator;
     using value_type = typename iterator::value_type;
 
@@ -21,17 +24,81 @@ public:
     Loop() = default;
 };
 
+template<class Iterator>
+class Loop<Iterator, false> final : public internal::BasicIteratorView<internal::LoopIterator<Iterator, false>> {
+public:
+    using iterator = internal::LoopIterator<Iterator, false>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+    using difference_type = typename iterator::difference_type;
+
+    // An empty sequence is never looped over, otherwise begin would never reach end
+    Loop(Iterator begin, Iterator end, const difference_type amount) :
+        internal::BasicIteratorView<iterator>(iterator(begin, begin, end, 0),
+                                              iterator(begin, begin, end, begin == end ? 0 : amount)) {
+    }
+
+    Loop() = default;
+};
+
+// Start of group
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Loops over the sequence [begin, end) forever.
+ * @param begin The beginning of the sequence. The sequence cannot be empty.
+ * @param end The ending of the sequence.
+ * @return A loop object that never reaches its end.
+ */
 template<LZ_CONCEPT_ITERATOR Iterator>
-Loop<Iterator> loopRange(Iterator begin, Iterator end) {
+Loop<Iterator, true> loopRange(Iterator begin, Iterator end) {
     LZ_ASSERT(begin != end, "View cannot be empty in order to loop over elements");
     return { std::move(begin), std::move(end) };
 }
 
+/**
+ * @brief Loops over the sequence `iterable` forever.
+ * @param iterable The sequence to loop over. The sequence cannot be empty.
+ * @return A loop object that never reaches its end.
+ */
 template<LZ_CONCEPT_ITERABLE Iterable>
-Loop<internal::IterTypeFromIterable<Iterable>> loop(Iterable&& iterable) {
+Loop<internal::IterTypeFromIterable<Iterable>, true> loop(Iterable&& iterable) {
     return loopRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)));
 }
 
+/**
+ * @brief Loops over the sequence [begin, end) `amount` times.
+ * @details The size of the view is `amount * length`, where only the length of [begin, end) is calculated, once. `copyTo` and
+ * `toVector` copy [begin, end) as a whole, `amount` times, so that contiguous trivially copyable data is copied using memmove.
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param amount The amount of times to loop over the sequence.
+ * @return A loop object that ends after `amount` rounds.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+Loop<Iterator, false> loopRange(Iterator begin, Iterator end, const internal::DiffType<Iterator> amount) {
+    LZ_ASSERT(amount >= 0, "amount cannot be negative");
+    return { std::move(begin), std::move(end), amount };
+}
+
+/**
+ * @brief Loops over the sequence `iterable` `amount` times. See `loopRange` for more details.
+ * @param iterable The sequence to loop over.
+ * @param amount The amount of times to loop over the sequence.
+ * @return A loop object that ends after `amount` rounds.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Iterator = internal::IterTypeFromIterable<Iterable>>
+Loop<Iterator, false> loop(Iterable&& iterable, const internal::DiffType<Iterator> amount) {
+    return loopRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), amount);
+}
+
+// End of group
+/**
+ * @}
+ */
 } // namespace lz
 
 #endif // LZ_LOOP_HPP
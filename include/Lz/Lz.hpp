@@ -3,7 +3,9 @@
 #ifndef LZ_LZ_HPP
 #    define LZ_LZ_HPP
 
+#    include "Lz/Cache.hpp"
 #    include "Lz/CartesianProduct.hpp"
+#    include "Lz/Choice.hpp"
 #    include "Lz/ChunkIf.hpp"
 #    include "Lz/Chunks.hpp"
 #    include "Lz/Enumerate.hpp"
@@ -15,10 +17,14 @@
 #    include "Lz/GroupBy.hpp"
 #    include "Lz/JoinWhere.hpp"
 #    include "Lz/Loop.hpp"
+#    include "Lz/QuantileSketch.hpp"
 #    include "Lz/Random.hpp"
 #    include "Lz/Range.hpp"
 #    include "Lz/Repeat.hpp"
 #    include "Lz/Rotate.hpp"
+#    include "Lz/Sample.hpp"
+#    include "Lz/Shuffled.hpp"
+#    include "Lz/Sorted.hpp"
 #    include "Lz/TakeEvery.hpp"
 #    include "Lz/Unique.hpp"
 // Function tools includes:
@@ -124,11 +130,18 @@ public:
 
     //! See Map.hpp for documentation
     template<class UnaryFunction>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::MapIterator<Iterator, UnaryFunction>>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<typename internal::MapFusion<Iterator, UnaryFunction>::type::iterator>
     map(UnaryFunction unaryFunction) const {
         return toIter(lz::map(*this, std::move(unaryFunction)));
     }
 
+    //! See Map.hpp for documentation
+    template<class UnaryFunction>
+    LZ_NODISCARD IterView<internal::MapIterator<Iterator, internal::MemoizedFunction<UnaryFunction, value_type>>>
+    memoMap(UnaryFunction unaryFunction, const std::size_t cacheSize) const {
+        return toIter(lz::memoMap(*this, std::move(unaryFunction), cacheSize));
+    }
+
     //! See Take.hpp for documentation.
     template<class UnaryPredicate>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<Iterator> takeWhile(UnaryPredicate predicate) const {
@@ -211,17 +224,83 @@ public:
     }
 
     //! See Loop.hpp for documentation
-    template<class Iterable>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::LoopIterator<Iterator>> loop() const {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::LoopIterator<Iterator, true>> loop() const {
         return toIter(lz::loop(*this));
     }
 
+    //! See Loop.hpp for documentation
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::LoopIterator<Iterator, false>>
+    loop(const internal::DiffType<Iterator> amount) const {
+        return toIter(lz::loop(*this, amount));
+    }
+
     template<class Iterable>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::RotateIterator<Iterator, internal::IsRandomAccess<Iterator>::value>>
     rotate(const internal::DiffType<iterator> start) const {
         return toIter(lz::rotate(*this, start));
     }
 
+    //! See Choice.hpp for documentation
+    template<class Weights>
+    LZ_NODISCARD IterView<internal::ChoiceIterator<Iterator, std::mt19937>>
+    choice(const Weights& weights, const std::size_t amount = (std::numeric_limits<std::size_t>::max)()) const {
+        return toIter(lz::choice(*this, weights, amount));
+    }
+
+    //! See Sample.hpp for documentation
+    template<class Generator>
+    LZ_NODISCARD std::vector<value_type> sample(const std::size_t k, Generator& generator) const {
+        return lz::sample(*this, k, generator);
+    }
+
+    //! See Sample.hpp for documentation
+    LZ_NODISCARD std::vector<value_type> sample(const std::size_t k) const {
+        return lz::sample(*this, k);
+    }
+
+    //! See Sample.hpp for documentation
+    template<class Generator>
+    LZ_NODISCARD IterView<internal::SampleRateIterator<Iterator, Generator>>
+    sampleRate(const double probability, Generator& generator) const {
+        return toIter(lz::sampleRate(*this, probability, generator));
+    }
+
+    //! See Sample.hpp for documentation
+    LZ_NODISCARD IterView<internal::SampleRateIterator<Iterator, std::mt19937>> sampleRate(const double probability) const {
+        return toIter(lz::sampleRate(*this, probability));
+    }
+
+    //! See Cache.hpp for documentation
+    template<class Allocator = std::allocator<value_type>>
+    LZ_NODISCARD IterView<internal::CacheIterator<Iterator, Allocator>> cache(const Allocator& allocator = Allocator()) const {
+        return toIter(lz::cache(*this, allocator));
+    }
+
+    //! See QuantileSketch.hpp for documentation
+    LZ_NODISCARD QuantileSketch<value_type> quantileSketch(const double epsilon = 0.01) const {
+        return lz::quantileSketch(*this, epsilon);
+    }
+
+    //! See Shuffled.hpp for documentation
+    LZ_NODISCARD IterView<internal::ShuffledIterator<Iterator>> shuffled(const std::uint64_t seed) const {
+        return toIter(lz::shuffled(*this, seed));
+    }
+
+    //! See Shuffled.hpp for documentation
+    LZ_NODISCARD IterView<internal::ShuffledIterator<Iterator>> shuffled() const {
+        return toIter(lz::shuffled(*this));
+    }
+
+    //! See Sorted.hpp for documentation
+#    ifdef LZ_HAS_CXX_11
+    template<class Compare = std::less<value_type>>
+#    else
+    template<class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+    LZ_NODISCARD IterView<internal::SortedIterator<Iterator, Compare>> sorted(Compare compare = {}) const {
+        return toIter(lz::sorted(*this, std::move(compare)));
+    }
+
     //! See FunctionTools.hpp `hasOne` for documentation.
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 bool hasOne() const {
         return lz::hasOne(*this);
@@ -247,8 +326,9 @@ public:
 #    ifdef LZ_HAS_EXECUTION
     //! See Filter.hpp for documentation.
     template<class UnaryPredicate, class Execution = std::execution::sequenced_policy>
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IterView<internal::FilterIterator<Iterator, UnaryPredicate, Execution>>
-    filter(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20
+        IterView<typename internal::FilterFusion<Iterator, UnaryPredicate, Execution>::type::iterator>
+        filter(UnaryPredicate predicate, Execution execution = std::execution::seq) const {
         return toIter(lz::filter(*this, std::move(predicate), execution));
     }
 
@@ -418,7 +498,8 @@ public:
     LZ_CONSTEXPR_CXX_20 IterView<Iterator>& forEach(UnaryFunc func, Execution execution = std::execution::seq) {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            std::for_each(Base::begin(), Base::end(), std::move(func));
+            using internal::forEachImpl;
+            forEachImpl(Base::begin(), Base::end(), std::move(func));
         }
         else {
             std::for_each(execution, Base::begin(), Base::end(), std::move(func));
@@ -436,7 +517,8 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 T foldl(T&& init, BinaryFunction function, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::reduce(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+            using internal::foldlImpl;
+            return foldlImpl(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
         }
         else {
             return std::reduce(execution, Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
@@ -483,7 +565,8 @@ public:
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get max element");
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return *std::max_element(Base::begin(), Base::end(), std::move(cmp));
+            using internal::maxElementImpl;
+            return *maxElementImpl(Base::begin(), Base::end(), std::move(cmp));
         }
         else {
             return *std::max_element(execution, Base::begin(), Base::end(), std::move(cmp));
@@ -501,7 +584,8 @@ public:
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get min element");
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return *std::min_element(Base::begin(), Base::end(), std::move(cmp));
+            using internal::minElementImpl;
+            return *minElementImpl(Base::begin(), Base::end(), std::move(cmp));
         }
         else {
             return *std::min_element(execution, Base::begin(), Base::end(), std::move(cmp));
@@ -514,12 +598,45 @@ public:
         return lz::mean(*this, std::move(binOp), execution);
     }
 
+    //! See FunctionTools.hpp for documentation
+    template<class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD Stats<value_type> stats(Execution execution = std::execution::seq) const {
+        return lz::stats(*this, execution);
+    }
+
     //! See FunctionTools.hpp for documentation
     template<class Compare = std::less<>, class Execution = std::execution::sequenced_policy>
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 double median(Compare compare = {}, Execution execution = std::execution::seq) const {
         return lz::median(*this, std::move(compare), execution);
     }
 
+    //! See FunctionTools.hpp for documentation
+    template<class Compare = std::less<>, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD std::vector<double>
+    quantiles(const std::vector<double>& qs, Compare compare = {}, Execution execution = std::execution::seq) const {
+        return lz::quantiles(*this, qs, std::move(compare), execution);
+    }
+
+    //! See FunctionTools.hpp for documentation
+    template<class Compare = std::less<>, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD std::vector<value_type>
+    topK(const std::size_t k, Compare compare = {}, Execution execution = std::execution::seq) const {
+        return lz::topK(*this, k, std::move(compare), execution);
+    }
+
+    //! See FunctionTools.hpp for documentation
+    template<class KeyFn, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD std::vector<value_type>
+    topKBy(const std::size_t k, KeyFn keyFn, Execution execution = std::execution::seq) const {
+        return lz::topKBy(*this, k, std::move(keyFn), execution);
+    }
+
+    //! See FunctionTools.hpp for documentation
+    template<class KeyFn = internal::Identity, class Execution = std::execution::sequenced_policy>
+    LZ_NODISCARD std::vector<value_type> toSortedVector(KeyFn keyFn = {}, Execution execution = std::execution::seq) const {
+        return lz::toSortedVector(*this, std::move(keyFn), execution);
+    }
+
     /**
      * Checks if all of the elements meet the condition `predicate`. `predicate` must return a bool and take a `value_type` as
      * parameter.
@@ -580,7 +697,8 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type count(const T& value, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
             static_cast<void>(execution);
-            return std::count(Base::begin(), Base::end(), value);
+            using internal::countImpl;
+            return countImpl(Base::begin(), Base::end(), value);
         }
         else {
             return std::count(execution, Base::begin(), Base::end(), value);
@@ -641,7 +759,8 @@ public:
 
     //! See Filter.hpp for documentation
     template<class UnaryPredicate>
-    IterView<internal::FilterIterator<Iterator, UnaryPredicate>> filter(UnaryPredicate predicate) const {
+    IterView<typename internal::FilterFusion<Iterator, UnaryPredicate>::type::iterator>
+    filter(UnaryPredicate predicate) const {
         return toIter(lz::filter(*this, std::move(predicate)));
     }
 
@@ -806,7 +925,8 @@ public:
      */
     template<class UnaryFunc>
     IterView<Iterator>& forEach(UnaryFunc func) {
-        std::for_each(Base::begin(), Base::end(), std::move(func));
+        using internal::forEachImpl;
+        forEachImpl(Base::begin(), Base::end(), std::move(func));
         return *this;
     }
 
@@ -818,7 +938,8 @@ public:
      */
     template<class T, class BinaryFunction>
     T foldl(T&& init, BinaryFunction function) const {
-        return internal::accumulate(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
+        using internal::foldlImpl;
+        return foldlImpl(Base::begin(), Base::end(), std::forward<T>(init), std::move(function));
     }
 
     /**
@@ -857,7 +978,8 @@ public:
 #        endif // LZ_HAS_CXX_11
     reference max(Compare cmp = {}) const {
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get max element");
-        return *std::max_element(Base::begin(), Base::end(), std::move(cmp));
+        using internal::maxElementImpl;
+        return *maxElementImpl(Base::begin(), Base::end(), std::move(cmp));
     }
 
     /**
@@ -872,7 +994,8 @@ public:
 #        endif // LZ_HAS_CXX_11
     reference min(Compare cmp = {}) const {
         LZ_ASSERT(!lz::empty(*this), "sequence cannot be empty in order to get min element");
-        return *std::min_element(Base::begin(), Base::end(), std::move(cmp));
+        using internal::minElementImpl;
+        return *minElementImpl(Base::begin(), Base::end(), std::move(cmp));
     }
 
     //! See FunctionTools.hpp for documentation
@@ -885,6 +1008,11 @@ public:
         return lz::mean(*this, std::move(binOp));
     }
 
+    //! See FunctionTools.hpp for documentation
+    Stats<value_type> stats() const {
+        return lz::stats(*this);
+    }
+
     //! See FunctionTools.hpp for documentation
 #        ifdef LZ_HAS_CXX_11
     template<class Compare = std::less<value_type>>
@@ -895,6 +1023,38 @@ public:
         return lz::median(*this, std::move(compare));
     }
 
+    //! See FunctionTools.hpp for documentation
+#        ifdef LZ_HAS_CXX_11
+    template<class Compare = std::less<value_type>>
+#        else
+    template<class Compare = std::less<>>
+#        endif // LZ_HAS_CXX_11
+    std::vector<double> quantiles(const std::vector<double>& qs, Compare compare = {}) const {
+        return lz::quantiles(*this, qs, std::move(compare));
+    }
+
+    //! See FunctionTools.hpp for documentation
+#        ifdef LZ_HAS_CXX_11
+    template<class Compare = std::less<value_type>>
+#        else
+    template<class Compare = std::less<>>
+#        endif // LZ_HAS_CXX_11
+    std::vector<value_type> topK(const std::size_t k, Compare compare = {}) const {
+        return lz::topK(*this, k, std::move(compare));
+    }
+
+    //! See FunctionTools.hpp for documentation
+    template<class KeyFn>
+    std::vector<value_type> topKBy(const std::size_t k, KeyFn keyFn) const {
+        return lz::topKBy(*this, k, std::move(keyFn));
+    }
+
+    //! See FunctionTools.hpp for documentation
+    template<class KeyFn = internal::Identity>
+    std::vector<value_type> toSortedVector(KeyFn keyFn = {}) const {
+        return lz::toSortedVector(*this, std::move(keyFn));
+    }
+
     /**
      * Checks if all of the elements meet the condition `predicate`. `predicate` must return a bool and take a `value_type` as
      * parameter.
@@ -932,7 +1092,8 @@ public:
      */
     template<class T>
     difference_type count(const T& value) const {
-        return std::count(Base::begin(), Base::end(), value);
+        using internal::countImpl;
+        return countImpl(Base::begin(), Base::end(), value);
     }
 
     /**
@@ -21,6 +21,29 @@ public:
     constexpr Map() = default;
 };
 
+namespace internal {
+// The view that `lz::map` returns for a sequence of `Iterator`
+template<class Iterator, class Function>
+struct MapFusion {
+    using type = Map<Iterator, Function>;
+
+    static LZ_CONSTEXPR_CXX_20 type make(Iterator begin, Iterator end, Function function) {
+        return { std::move(begin), std::move(end), std::move(function) };
+    }
+};
+
+// A map of a map is fused into a single map over the underlying sequence, using the composition of both functions
+template<class Iterator, class Inner, class Function>
+struct MapFusion<MapIterator<Iterator, Inner>, Function> {
+    using type = Map<Iterator, ComposedFunction<Inner, Function>>;
+
+    static LZ_CONSTEXPR_CXX_20 type
+    make(const MapIterator<Iterator, Inner>& begin, const MapIterator<Iterator, Inner>& end, Function function) {
+        return { begin.base(), end.base(), ComposedFunction<Inner, Function>(begin.function(), std::move(function)) };
+    }
+};
+} // namespace internal
+
 // Start of group
 /**
  * @addtogroup ItFns
@@ -46,17 +69,57 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<Iterator, Function> mapRange(Iterator begin
 /**
  * @brief Returns a bidirectional map object.
  * @details E.g. `map({std::pair(1, 2), std::pair(3, 2)}, [](std::pair<int, int> pairs) { return pair.first; });`
- * will return all pairs first values in the sequence, that is, `1` and `3`.
+ * will return all pairs first values in the sequence, that is, `1` and `3`. If `iterable` is a map object itself, the result is
+ * a single map object over its underlying sequence, using the composition of both functions, instead of a map of a map. I.e.
+ * `lz::map(lz::map(vec, f), g)` is a `Map<std::vector<T>::iterator, ...>` that calls `g(f(x))`.
  * @param iterable The iterable to do the mapping over.
  * @param function A function that takes a value type as parameter. It may return anything.
  * @return A Map object that can be converted to an arbitrary container or can be iterated over using
  * `for (auto... lz::map(...))`.
  */
 template<class Function, LZ_CONCEPT_ITERABLE Iterable>
-LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Map<internal::IterTypeFromIterable<Iterable>, Function>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_20 typename internal::MapFusion<internal::IterTypeFromIterable<Iterable>, Function>::type
 map(Iterable&& iterable, Function function) {
-    return mapRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
-                    std::move(function));
+    return internal::MapFusion<internal::IterTypeFromIterable<Iterable>, Function>::make(
+        internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), std::move(function));
+}
+
+/**
+ * @brief Returns a map object of which the results of `function` are cached, for pure functions that are expensive and of
+ * which the inputs repeat, such as parsing or lookups.
+ * @details The cache is direct-mapped: every input maps to a single slot, by its hash, which holds the last input that mapped to
+ * it and its result. A hit therefore only takes a hash and a comparison, and lookups never allocate. The cache has (at least)
+ * `cacheSize` slots, and is shared by all copies of the view and its iterators, so it cannot be used from multiple threads at
+ * once; use a separate `memoMap` per thread instead. The input type must be hashable using `std::hash` and equality comparable,
+ * the input and result types must be default constructible. Example:
+ * ```cpp
+ * auto countries = lz::memoMap(ips, [](const std::string& ip) { return geoLookup(ip); }, 1024);
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param function A pure function that takes a value type as parameter.
+ * @param cacheSize The amount of results to cache.
+ * @return A Map object from [begin, end) of which the results of `function` are cached.
+ */
+template<class Function, LZ_CONCEPT_ITERATOR Iterator, class Key = internal::ValueType<Iterator>>
+LZ_NODISCARD Map<Iterator, internal::MemoizedFunction<Function, Key>>
+memoMapRange(Iterator begin, Iterator end, Function function, const std::size_t cacheSize) {
+    return { std::move(begin), std::move(end), internal::MemoizedFunction<Function, Key>(std::move(function), cacheSize) };
+}
+
+/**
+ * @brief Returns a map object of which the results of `function` are cached. See `lz::memoMapRange` for more details.
+ * @param iterable The iterable to do the mapping over.
+ * @param function A pure function that takes a value type as parameter.
+ * @param cacheSize The amount of results to cache.
+ * @return A Map object of which the results of `function` are cached.
+ */
+template<class Function, LZ_CONCEPT_ITERABLE Iterable, class Iterator = internal::IterTypeFromIterable<Iterable>,
+         class Key = internal::ValueType<Iterator>>
+LZ_NODISCARD Map<Iterator, internal::MemoizedFunction<Function, Key>>
+memoMap(Iterable&& iterable, Function function, const std::size_t cacheSize) {
+    return memoMapRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                        std::move(function), cacheSize);
 }
 
 // End of group
@@ -0,0 +1,301 @@
+#pragma once
+
+#ifndef LZ_QUANTILE_SKETCH_HPP
+#    define LZ_QUANTILE_SKETCH_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+
+#    include <algorithm>
+#    include <cmath>
+#    include <cstdint>
+#    include <functional>
+#    include <utility>
+#    include <vector>
+
+namespace lz {
+/**
+ * @brief A KLL sketch: approximates the quantiles of a stream of values using bounded memory.
+ * @details Values are inserted into the first level of a stack of compactors. If the sketch is full, a level that has
+ * reached its capacity is sorted and compacted: every other value is promoted to the next level, where it counts twice, the
+ * others are discarded. The capacities shrink by a factor 2/3 for every level below the top one, so the sketch stores
+ * O(k + log(n)) values in total, where k ~ 2 / epsilon. The rank of a value returned by `quantile` is off by about
+ * `epsilon * count()`. The minimum and maximum are tracked exactly. Sketches can be merged, so a stream can be split over
+ * multiple threads, each with its own sketch, and merged afterwards.
+ * @tparam T The value type, must be copyable and default constructible.
+ * @tparam Compare The comparer used to order the values.
+ */
+template<class T, class Compare = std::less<T>>
+class QuantileSketch {
+    std::vector<std::vector<T>> _levels{};
+    Compare _compare{};
+    std::size_t _k{};
+    std::size_t _stored{};
+    std::size_t _maxStored{};
+    std::uint64_t _count{};
+    std::uint64_t _seed{};
+    T _min{};
+    T _max{};
+
+    std::size_t capacity(const std::size_t level) const {
+        const auto depth = static_cast<double>(_levels.size() - level - 1);
+        const auto cap = static_cast<std::size_t>(std::ceil(std::pow(2. / 3., depth) * static_cast<double>(_k)));
+        return (std::max)(cap, std::size_t{ 2 });
+    }
+
+    void grow() {
+        _levels.emplace_back();
+        _maxStored = 0;
+        for (std::size_t level = 0; level < _levels.size(); ++level) {
+            _maxStored += capacity(level);
+        }
+    }
+
+    // Compacts the lowest level that has reached its capacity. The coin flip that decides whether the values at the even or
+    // the odd positions are promoted keeps the estimated ranks unbiased
+    void compress() {
+        for (std::size_t level = 0; level < _levels.size(); ++level) {
+            if (_levels[level].size() < capacity(level)) {
+                continue;
+            }
+            if (level + 1 == _levels.size()) {
+                grow();
+            }
+            auto& current = _levels[level];
+            auto& next = _levels[level + 1];
+            std::sort(current.begin(), current.end(), _compare);
+
+            _seed = internal::splitMix64(_seed);
+            const std::size_t pairs = current.size() / 2;
+            for (std::size_t i = static_cast<std::size_t>(_seed & 1u); i < pairs * 2; i += 2) {
+                next.push_back(std::move(current[i]));
+            }
+            if (current.size() % 2 != 0) {
+                current.front() = std::move(current.back());
+                current.resize(1);
+            }
+            else {
+                current.clear();
+            }
+            _stored -= pairs;
+            return;
+        }
+    }
+
+    // All stored values with their weights, sorted by value
+    std::vector<std::pair<T, std::uint64_t>> weightedValues() const {
+        std::vector<std::pair<T, std::uint64_t>> values;
+        values.reserve(_stored);
+        for (std::size_t level = 0; level < _levels.size(); ++level) {
+            for (const T& value : _levels[level]) {
+                values.emplace_back(value, std::uint64_t{ 1 } << level);
+            }
+        }
+        const Compare& compare = _compare;
+        std::sort(values.begin(), values.end(),
+                  [&compare](const std::pair<T, std::uint64_t>& a, const std::pair<T, std::uint64_t>& b) {
+                      return compare(a.first, b.first);
+                  });
+        return values;
+    }
+
+public:
+    /**
+     * Creates an empty sketch.
+     * @param epsilon The (approximate) maximum rank error of a quantile, as a fraction of the amount of values.
+     * @param compare The comparer used to order the values.
+     * @param seed The seed used for the compactions.
+     */
+    explicit QuantileSketch(const double epsilon = 0.01, Compare compare = {}, const std::uint64_t seed = 0) :
+        _compare(std::move(compare)),
+        _k((std::max)(static_cast<std::size_t>(std::ceil(2. / epsilon)), std::size_t{ 8 })),
+        _seed(seed) {
+        LZ_ASSERT(epsilon > 0 && epsilon < 1, "epsilon must be in (0, 1)");
+        grow();
+    }
+
+    /**
+     * Adds `value` to the sketch. Takes amortized O(log(k)) time.
+     * @param value The value to add.
+     */
+    void insert(const T& value) {
+        if (_count == 0 || _compare(value, _min)) {
+            _min = value;
+        }
+        if (_count == 0 || _compare(_max, value)) {
+            _max = value;
+        }
+        ++_count;
+        _levels.front().push_back(value);
+        if (++_stored >= _maxStored) {
+            compress();
+        }
+    }
+
+    /**
+     * Adds all values of `other` to this sketch, as if they were inserted into this sketch. `other` may be this sketch.
+     * @param other The sketch to merge with.
+     */
+    void merge(const QuantileSketch& other) {
+        if (other._count == 0) {
+            return;
+        }
+        if (&other == this) {
+            // Inserting a range of a vector into itself is undefined behaviour, so merge with a copy instead
+            const QuantileSketch copy(other);
+            merge(copy);
+            return;
+        }
+        while (_levels.size() < other._levels.size()) {
+            grow();
+        }
+        for (std::size_t level = 0; level < other._levels.size(); ++level) {
+            _levels[level].insert(_levels[level].end(), other._levels[level].begin(), other._levels[level].end());
+        }
+        _min = _count == 0 || _compare(other._min, _min) ? other._min : _min;
+        _max = _count == 0 || _compare(_max, other._max) ? other._max : _max;
+        _count += other._count;
+        _stored += other._stored;
+        while (_stored >= _maxStored) {
+            compress();
+        }
+    }
+
+    //! The amount of values that have been inserted.
+    LZ_NODISCARD std::uint64_t count() const noexcept {
+        return _count;
+    }
+
+    //! Returns true if no values have been inserted.
+    LZ_NODISCARD bool empty() const noexcept {
+        return _count == 0;
+    }
+
+    //! The amount of values currently stored, which is O(k + log(count())).
+    LZ_NODISCARD std::size_t storedCount() const noexcept {
+        return _stored;
+    }
+
+    //! The exact minimum. The sketch cannot be empty.
+    LZ_NODISCARD const T& min() const {
+        LZ_ASSERT(!empty(), "sketch cannot be empty in order to get its minimum");
+        return _min;
+    }
+
+    //! The exact maximum. The sketch cannot be empty.
+    LZ_NODISCARD const T& max() const {
+        LZ_ASSERT(!empty(), "sketch cannot be empty in order to get its maximum");
+        return _max;
+    }
+
+    /**
+     * Estimates the fraction of values that are less than or equal to `value`.
+     * @param value The value to get the rank of.
+     * @return The estimated rank in [0, 1], or 0 if the sketch is empty.
+     */
+    LZ_NODISCARD double rank(const T& value) const {
+        if (empty()) {
+            return 0;
+        }
+        std::uint64_t weight = 0;
+        for (std::size_t level = 0; level < _levels.size(); ++level) {
+            for (const T& stored : _levels[level]) {
+                if (!_compare(value, stored)) {
+                    weight += std::uint64_t{ 1 } << level;
+                }
+            }
+        }
+        return static_cast<double>(weight) / static_cast<double>(_count);
+    }
+
+    /**
+     * Estimates the `q`-quantile, for e.g. 0.5 for the median or 0.99 for the 99th percentile. 0 and 1 return the exact
+     * minimum and maximum. The sketch cannot be empty.
+     * @param q The quantile in [0, 1].
+     * @return A value of which the rank is close to `q`.
+     */
+    LZ_NODISCARD T quantile(const double q) const {
+        return quantiles({ q }).front();
+    }
+
+    /**
+     * Estimates multiple quantiles at once, which only sorts the stored values once. The sketch cannot be empty.
+     * @param qs The quantiles, each in [0, 1].
+     * @return The estimated quantiles, in the same order as `qs`.
+     */
+    LZ_NODISCARD std::vector<T> quantiles(const std::vector<double>& qs) const {
+        LZ_ASSERT(!empty(), "sketch cannot be empty in order to get a quantile");
+        const auto values = weightedValues();
+        std::vector<T> result;
+        result.reserve(qs.size());
+        for (const double q : qs) {
+            LZ_ASSERT(q >= 0 && q <= 1, "quantile must be in [0, 1]");
+            if (q <= 0) {
+                result.push_back(_min);
+                continue;
+            }
+            if (q >= 1) {
+                result.push_back(_max);
+                continue;
+            }
+            const double target = q * static_cast<double>(_count);
+            std::uint64_t cumulative = 0;
+            auto it = values.begin();
+            for (; it != values.end() - 1; ++it) {
+                cumulative += it->second;
+                if (static_cast<double>(cumulative) >= target) {
+                    break;
+                }
+            }
+            result.push_back(it->first);
+        }
+        return result;
+    }
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Builds a `lz::QuantileSketch` of [begin, end) in a single pass, using bounded memory. The sequence is not modified,
+ * so (unlike `lz::median`) any view can be used, for e.g. a `lz::map` or `lz::filter` view. Example:
+ * ```cpp
+ * auto sketch = lz::quantileSketch(lz::map(requests, [](const Request& r) { return r.latency; }), 0.001);
+ * auto p99 = sketch.quantile(0.99);
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param epsilon The (approximate) maximum rank error of a quantile, as a fraction of the length of the sequence.
+ * @return A sketch containing all values of [begin, end), which can be merged with other sketches.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD QuantileSketch<internal::ValueType<Iterator>>
+quantileSketchRange(Iterator begin, Iterator end, const double epsilon = 0.01) {
+    using internal::forEachImpl;
+    QuantileSketch<internal::ValueType<Iterator>> sketch(epsilon);
+    forEachImpl(std::move(begin), std::move(end),
+                [&sketch](const internal::ValueType<Iterator>& value) { sketch.insert(value); });
+    return sketch;
+}
+
+/**
+ * @brief Builds a `lz::QuantileSketch` of `iterable` in a single pass, using bounded memory. See `lz::quantileSketchRange`
+ * for more details.
+ * @param iterable The sequence to sketch.
+ * @param epsilon The (approximate) maximum rank error of a quantile, as a fraction of the length of the sequence.
+ * @return A sketch containing all values of `iterable`, which can be merged with other sketches.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Iterator = internal::IterTypeFromIterable<Iterable>>
+LZ_NODISCARD QuantileSketch<internal::ValueType<Iterator>> quantileSketch(Iterable&& iterable, const double epsilon = 0.01) {
+    return quantileSketchRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                               epsilon);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_QUANTILE_SKETCH_HPP
@@ -0,0 +1,183 @@
+#pragma once
+
+#ifndef LZ_SAMPLE_HPP
+#    define LZ_SAMPLE_HPP
+
+#    include "Random.hpp"
+#    include "detail/SampleIterator.hpp"
+
+#    include <cmath>
+#    include <vector>
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class Generator>
+class SampleRate final : public internal::BasicIteratorView<internal::SampleRateIterator<Iterator, Generator>> {
+public:
+    using iterator = internal::SampleRateIterator<Iterator, Generator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+    SampleRate(Iterator begin, Iterator end, const double probability, Generator& generator) :
+        internal::BasicIteratorView<iterator>(iterator(begin, end, probability, generator),
+                                              iterator(end, end, probability, generator)) {
+    }
+
+    SampleRate() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Takes a uniform random sample of (at most) `k` elements of [begin, end) in a single pass, without knowing the length
+ * of the sequence up front.
+ * @details Uses reservoir sampling (Algorithm L). Instead of drawing a random number for every element, the amount of elements
+ * to skip until the next replacement is drawn, so that the generator is only called O(k log(n / k)) times. Skipped elements
+ * are not dereferenced, and if the iterator is random access, they are jumped over at once. The order of the elements in the
+ * resulting sample is unspecified. Example:
+ * ```cpp
+ * std::mt19937 gen(std::random_device{}());
+ * auto lines = lz::lines(logFile);
+ * std::vector<lz::StringView> sample = lz::sampleRange(lines.begin(), lines.end(), 100, gen);
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param k The (maximum) size of the sample. If [begin, end) contains less than `k` elements, all elements are returned.
+ * @param generator A random number generator, for e.g. std::mt19937.
+ * @return A `std::vector` containing the sample.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Generator>
+LZ_NODISCARD std::vector<internal::ValueType<Iterator>>
+sampleRange(Iterator begin, const Iterator end, const std::size_t k, Generator& generator) {
+    using DiffType = internal::DiffType<Iterator>;
+
+    std::vector<internal::ValueType<Iterator>> reservoir;
+    if (k == 0) {
+        return reservoir;
+    }
+    reservoir.reserve(k);
+    for (; begin != end && reservoir.size() < k; ++begin) {
+        reservoir.emplace_back(*begin);
+    }
+    if (begin == end) {
+        return reservoir;
+    }
+
+    // Draws from (0, 1], so that its log is always finite
+    const auto random = [&generator]() {
+        return 1. - std::generate_canonical<double, std::numeric_limits<double>::digits>(generator);
+    };
+    std::uniform_int_distribution<std::size_t> index(0, k - 1);
+    const double kReciprocal = 1. / static_cast<double>(k);
+    double w = std::exp(std::log(random()) * kReciprocal);
+
+    while (true) {
+        const double skip = std::floor(std::log(random()) / std::log1p(-w));
+        if (!(skip < static_cast<double>((std::numeric_limits<DiffType>::max)()))) {
+            break;
+        }
+        internal::advanceAtMost(begin, end, static_cast<DiffType>(skip));
+        if (begin == end) {
+            break;
+        }
+        reservoir[index(generator)] = *begin;
+        ++begin;
+        w *= std::exp(std::log(random()) * kReciprocal);
+    }
+    return reservoir;
+}
+
+/**
+ * @brief Takes a uniform random sample of (at most) `k` elements of `iterable` in a single pass. See `lz::sampleRange` for
+ * more details.
+ * @param iterable The sequence to sample from.
+ * @param k The (maximum) size of the sample. If `iterable` contains less than `k` elements, all elements are returned.
+ * @param generator A random number generator, for e.g. std::mt19937.
+ * @return A `std::vector` containing the sample.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Generator>
+LZ_NODISCARD std::vector<internal::ValueType<internal::IterTypeFromIterable<Iterable>>>
+sample(Iterable&& iterable, const std::size_t k, Generator& generator) {
+    return sampleRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), k,
+                       generator);
+}
+
+/**
+ * @brief Takes a uniform random sample of (at most) `k` elements of `iterable` in a single pass. It uses the same std::mt19937
+ * engine setup as `lz::random`. See `lz::sampleRange` for more details.
+ * @param iterable The sequence to sample from.
+ * @param k The (maximum) size of the sample. If `iterable` contains less than `k` elements, all elements are returned.
+ * @return A `std::vector` containing the sample.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD std::vector<internal::ValueType<internal::IterTypeFromIterable<Iterable>>>
+sample(Iterable&& iterable, const std::size_t k) {
+    static std::mt19937 gen = internal::createMtEngine();
+    return sample(std::forward<Iterable>(iterable), k, gen);
+}
+
+/**
+ * @brief Returns a view that selects every element of [begin, end) independently with probability `probability` (Bernoulli
+ * sampling).
+ * @details Rather than flipping a coin for every element, the distance to the next selected element is drawn from a geometric
+ * distribution, so the generator is called once per selected element. Skipped elements are not dereferenced, and if the
+ * iterator is random access, they are jumped over at once. The selected elements keep their relative order. The view is an
+ * input view: every pass over it (or over a copy of its iterators) draws new skips, and therefore yields another subsequence.
+ * Example:
+ * ```cpp
+ * std::mt19937 gen(std::random_device{}());
+ * auto lines = lz::lines(logFile);
+ * // Yields roughly 1 in 1000 lines
+ * auto sampled = lz::sampleRateRange(lines.begin(), lines.end(), 0.001, gen);
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param probability The probability of an element being selected. Must be in (0, 1].
+ * @param generator A random number generator, for e.g. std::mt19937.
+ * @return An input iterator view object that yields the selected elements.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Generator>
+LZ_NODISCARD SampleRate<Iterator, Generator>
+sampleRateRange(Iterator begin, Iterator end, const double probability, Generator& generator) {
+    LZ_ASSERT(probability > 0 && probability <= 1, "probability must be in (0, 1]");
+    return { std::move(begin), std::move(end), probability, generator };
+}
+
+/**
+ * @brief Returns a view that selects every element of `iterable` independently with probability `probability`. See
+ * `lz::sampleRateRange` for more details.
+ * @param iterable The sequence to sample from.
+ * @param probability The probability of an element being selected. Must be in (0, 1].
+ * @param generator A random number generator, for e.g. std::mt19937.
+ * @return An input iterator view object that yields the selected elements.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable, class Generator>
+LZ_NODISCARD SampleRate<internal::IterTypeFromIterable<Iterable>, Generator>
+sampleRate(Iterable&& iterable, const double probability, Generator& generator) {
+    return sampleRateRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                           probability, generator);
+}
+
+/**
+ * @brief Returns a view that selects every element of `iterable` independently with probability `probability`. It uses the
+ * same std::mt19937 engine setup as `lz::random`. See `lz::sampleRateRange` for more details.
+ * @param iterable The sequence to sample from.
+ * @param probability The probability of an element being selected. Must be in (0, 1].
+ * @return An input iterator view object that yields the selected elements.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD SampleRate<internal::IterTypeFromIterable<Iterable>, std::mt19937>
+sampleRate(Iterable&& iterable, const double probability) {
+    static std::mt19937 gen = internal::createMtEngine();
+    return sampleRate(std::forward<Iterable>(iterable), probability, gen);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_SAMPLE_HPP
@@ -0,0 +1,92 @@
+#pragma once
+
+#ifndef LZ_SHUFFLED_HPP
+#    define LZ_SHUFFLED_HPP
+
+#    include "Random.hpp"
+#    include "detail/ShuffledIterator.hpp"
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator>
+class Shuffled final : public internal::BasicIteratorView<internal::ShuffledIterator<Iterator>> {
+public:
+    using iterator = internal::ShuffledIterator<Iterator>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Base = internal::BasicIteratorView<iterator>;
+
+public:
+    LZ_CONSTEXPR_CXX_14
+    Shuffled(Iterator begin, const typename iterator::difference_type size, const internal::FeistelPermutation& permutation) :
+        Base(iterator(begin, permutation, 0), iterator(begin, permutation, size)) {
+    }
+
+    constexpr Shuffled() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a random access view that yields the elements of [begin, end) in a pseudo random order, without copying or
+ * shuffling anything.
+ * @details Position `i` of the view is mapped to a pseudo random bijection of [0, n), where n is the length of [begin, end).
+ * This is done using a cycle walking Feistel network, so the view itself only takes O(1) memory and every access takes
+ * (expected) O(1) time. The same `seed` always yields the same order, which makes it suitable for reproducible, randomized
+ * batches, using for e.g. `lz::chunks` afterwards. The permutation is not cryptographically secure. Example:
+ * ```cpp
+ * std::vector<int> vec = { 1, 2, 3, 4, 5 };
+ * auto shuffled = lz::shuffledRange(vec.begin(), vec.end(), 1234);
+ * // shuffled yields all elements of vec exactly once, in a random order
+ * ```
+ * @param begin The beginning of the sequence. Must be random access.
+ * @param end The ending of the sequence. Must be random access.
+ * @param seed The seed that determines the permutation.
+ * @return A random access view object that yields the elements of [begin, end) in a pseudo random order.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 Shuffled<Iterator> shuffledRange(Iterator begin, Iterator end, const std::uint64_t seed) {
+    static_assert(internal::IsRandomAccess<Iterator>::value, "the iterator type must be random access");
+    const auto size = internal::getIterLength(begin, end);
+    return { std::move(begin), size, internal::FeistelPermutation(static_cast<std::uint64_t>(size), seed) };
+}
+
+/**
+ * @brief Returns a random access view that yields the elements of `iterable` in a pseudo random order, without copying or
+ * shuffling anything. See `lz::shuffledRange` for more details.
+ * @param iterable The sequence to shuffle. Its iterator must be random access.
+ * @param seed The seed that determines the permutation.
+ * @return A random access view object that yields the elements of `iterable` in a pseudo random order.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD LZ_CONSTEXPR_CXX_14 Shuffled<internal::IterTypeFromIterable<Iterable>>
+shuffled(Iterable&& iterable, const std::uint64_t seed) {
+    return shuffledRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                         seed);
+}
+
+/**
+ * @brief Returns a random access view that yields the elements of `iterable` in a pseudo random order, without copying or
+ * shuffling anything. The seed is drawn from the same std::mt19937 engine setup as `lz::random`. See `lz::shuffledRange` for
+ * more details.
+ * @param iterable The sequence to shuffle. Its iterator must be random access.
+ * @return A random access view object that yields the elements of `iterable` in a pseudo random order.
+ */
+template<LZ_CONCEPT_ITERABLE Iterable>
+LZ_NODISCARD Shuffled<internal::IterTypeFromIterable<Iterable>> shuffled(Iterable&& iterable) {
+    static std::mt19937 gen = internal::createMtEngine();
+    const std::uint64_t seed = (static_cast<std::uint64_t>(gen()) << 32u) | static_cast<std::uint64_t>(gen());
+    return shuffled(std::forward<Iterable>(iterable), seed);
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_SHUFFLED_HPP
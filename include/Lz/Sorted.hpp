@@ -0,0 +1,89 @@
+#pragma once
+
+#ifndef LZ_SORTED_HPP
+#    define LZ_SORTED_HPP
+
+#    include "detail/BasicIteratorView.hpp"
+#    include "detail/SortedIterator.hpp"
+
+#    include <functional>
+
+namespace lz {
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare>
+class Sorted final : public internal::BasicIteratorView<internal::SortedIterator<Iterator, Compare>> {
+public:
+    using iterator = internal::SortedIterator<Iterator, Compare>;
+    using const_iterator = iterator;
+    using value_type = typename iterator::value_type;
+
+private:
+    using Base = internal::BasicIteratorView<iterator>;
+    using State = internal::IncrementalSort<Iterator, Compare>;
+
+    explicit Sorted(const std::shared_ptr<State>& state) : Base(iterator(state, 0), iterator::end(state)) {
+    }
+
+public:
+    Sorted(Iterator begin, Iterator end, Compare compare) :
+        Sorted(std::make_shared<State>(std::move(begin), std::move(end), std::move(compare))) {
+    }
+
+    Sorted() = default;
+};
+
+/**
+ * @addtogroup ItFns
+ * @{
+ */
+
+/**
+ * @brief Returns a random access view that yields the elements of [begin, end) in sorted order, of which only the part that is
+ * used is sorted.
+ * @details The sequence is copied into a buffer once, the first time the view is used. After that, the buffer is sorted
+ * incrementally, using incremental quicksort: getting the first m elements takes O(n + m log(n)) instead of O(n log(n)), while
+ * m does not have to be known in advance. This makes it suitable for paginated results, or for `lz::take` and `lz::takeWhile`
+ * afterwards. Iterating over a whole range at once, for e.g. using `toVector()`, sorts that range at once. All copies of the
+ * view (and its iterators) share the same buffer, so the view cannot be used from multiple threads at once. Example:
+ * ```cpp
+ * std::vector<int> vec = { 5, 3, 4, 1, 2 };
+ * auto sorted = lz::sortedRange(vec.begin(), vec.end());
+ * auto smallest = lz::take(sorted, 2); // { 1, 2 }, without sorting { 3, 4, 5 }
+ * ```
+ * @param begin The beginning of the sequence.
+ * @param end The ending of the sequence.
+ * @param compare The comparer used to order the elements.
+ * @return A random access view object that yields the elements of [begin, end) in sorted order.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = std::less<internal::ValueType<Iterator>>>
+#    else
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD Sorted<Iterator, Compare> sortedRange(Iterator begin, Iterator end, Compare compare = {}) {
+    return { std::move(begin), std::move(end), std::move(compare) };
+}
+
+/**
+ * @brief Returns a random access view that yields the elements of `iterable` in sorted order, of which only the part that is
+ * used is sorted. See `lz::sortedRange` for more details.
+ * @param iterable The sequence to sort.
+ * @param compare The comparer used to order the elements.
+ * @return A random access view object that yields the elements of `iterable` in sorted order.
+ */
+#    ifdef LZ_HAS_CXX_11
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<internal::ValueTypeIterable<Iterable>>>
+#    else
+template<LZ_CONCEPT_ITERABLE Iterable, class Compare = std::less<>>
+#    endif // LZ_HAS_CXX_11
+LZ_NODISCARD Sorted<internal::IterTypeFromIterable<Iterable>, Compare> sorted(Iterable&& iterable, Compare compare = {}) {
+    return sortedRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)),
+                       std::move(compare));
+}
+
+// End of group
+/**
+ * @}
+ */
+} // namespace lz
+
+#endif // LZ_SORTED_HPP
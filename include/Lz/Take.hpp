@@ -51,7 +51,8 @@ take(Iterable&& iterable, const internal::DiffType<IterType> amount) {
 }
 
 /**
- * Drops an amount of items, starting from begin.
+ * Drops an amount of items, starting from begin. Only the first `amount` items are walked over, the end of the sequence is kept
+ * as is, so dropping from a forward sequence does not need its length.
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param amount The amount of items to drop, which is equivalent to next(begin, amount)
@@ -62,11 +63,11 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<Iterator>
 dropRange(Iterator begin, Iterator end, const internal::DiffType<Iterator> amount) {
     using lz::next;
     using std::next;
-    return takeRange(next(begin, amount), end, internal::getIterLength(begin, end) - amount);
+    return { next(std::move(begin), amount), std::move(end) };
 }
 
 /**
- * Drops an amount of items, starting from begin.
+ * Drops an amount of items, starting from begin. See `lz::dropRange` for more details.
  * @param iterable The iterable to drop from.
  * @param amount The amount of items to drop, which is equivalent to next(begin, amount)
  * @return A Take iterator where the first `amount` items have been dropped.
@@ -74,11 +75,7 @@ dropRange(Iterator begin, Iterator end, const internal::DiffType<Iterator> amoun
 template<LZ_CONCEPT_ITERABLE Iterable, class IterType = internal::IterTypeFromIterable<Iterable>>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<IterType>
 drop(Iterable&& iterable, const internal::DiffType<IterType> amount) {
-    using lz::next;
-    using std::next;
-    auto begin = std::begin(iterable);
-    auto end = std::end(iterable);
-    return takeRange(next(begin, amount), end, static_cast<internal::DiffTypeIterable<Iterable>>(iterable.size()) - amount);
+    return dropRange(internal::begin(std::forward<Iterable>(iterable)), internal::end(std::forward<Iterable>(iterable)), amount);
 }
 
 /**
@@ -156,7 +153,6 @@ takeWhile(Iterable&& iterable, Function predicate, Execution execution = std::ex
 template<LZ_CONCEPT_ITERATOR Iterator, class Function, class Execution = std::execution::sequenced_policy>
 LZ_NODISCARD LZ_CONSTEXPR_CXX_20 internal::BasicIteratorView<Iterator>
 dropWhileRange(Iterator begin, Iterator end, Function predicate, Execution execution = std::execution::seq) {
-    using ValueType = internal::ValueType<Iterator>;
     if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
         static_cast<void>(execution);
         begin = std::find_if_not(std::move(begin), end, std::move(predicate));
@@ -164,7 +160,7 @@ dropWhileRange(Iterator begin, Iterator end, Function predicate, Execution execu
     else {
         begin = std::find_if_not(execution, std::move(begin), end, std::move(predicate));
     }
-    return takeRange(begin, end, internal::getIterLength(begin, end));
+    return { std::move(begin), std::move(end) };
 }
 
 /**
@@ -229,7 +225,7 @@ takeWhile(Iterable&& iterable, Function predicate) {
 template<LZ_CONCEPT_ITERATOR Iterator, class Function>
 internal::BasicIteratorView<Iterator> dropWhileRange(Iterator begin, Iterator end, Function predicate) {
     begin = std::find_if_not(std::move(begin), end, std::move(predicate));
-    return takeRange(begin, end, internal::getIterLength(begin, end));
+    return { std::move(begin), std::move(end) };
 }
 
 /**
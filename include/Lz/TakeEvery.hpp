@@ -55,7 +55,9 @@ public:
  * an STL iterator, pass a pointer iterator, not an actual iterator object.
  * @details If one would like to select every 2nd argument one can use this iterator. Example (pseudo code):
  * `takeEvery({1, 2, 3}, 2)`. This will select `1` and `3`. If you would like to skip the first element as well
- * one can use: `takeEvery({1, 2, 3}, 2, 2)` the second `2` is the start indexOf, making it select only `3`.
+ * one can use: `takeEvery({1, 2, 3}, 2, 2)` the second `2` is the start indexOf, making it select only `3`. If the iterator is
+ * random access, `size()` is O(1) and `copyTo`, `toVector` and `forEach` index the sequence directly, using a constant stride
+ * for offsets 2, 3 and 4.
  * @param begin The beginning of the sequence.
  * @param end The ending of the sequence.
  * @param offset The index to add every iteration, aka the index to 'select'.
@@ -76,6 +76,9 @@ public:
  * @details The tuple that is returned by `operator*` returns a `std::tuple` by value and its elements by
  * reference e.g. `std::tuple<Args&...>`. So it is possible to alter the values in the container/iterable),
  * unless the iterator is const, making it a const reference.
+ * If all the iterators are contiguous, one index is used for all of them, so that `++` and the end check only increment and
+ * compare a single counter. Before C++20 only pointers and the iterators of `std::vector` and `std::string` are recognized as
+ * contiguous, so this includes the iterators of `std::array` only where they are pointers.
  * @param begin The beginning of the sequence
  * @param end The ending of the sequence
  * @return A Take object that can be converted to an arbitrary container or can be iterated over using
@@ -97,6 +100,9 @@ LZ_NODISCARD LZ_CONSTEXPR_CXX_20 Zip<Iterators...> zipRange(std::tuple<Iterators
  * @details The tuple that is returned by `operator*` returns a `std::tuple` by value and its elements by
  * reference e.g. `std::tuple<Args&...>`. So it is possible to alter the values in the container/iterable),
  * unless the iterator is const, making it a const reference.
+ * If all the iterators are contiguous, one index is used for all of them, so that `++` and the end check only increment and
+ * compare a single counter. Before C++20 only pointers and the iterators of `std::vector` and `std::string` are recognized as
+ * contiguous, so this includes the iterators of `std::array` only where they are pointers.
  * @param iterables The iterables to iterate simultaneously over.
  * @return A Take object that can be converted to an arbitrary container or can be iterated over using
  * `for (auto tuple :  lz::zip(...))`.
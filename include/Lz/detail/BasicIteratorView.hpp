@@ -279,6 +279,70 @@ struct HasReserve : std::false_type {};
 template<class T>
 struct HasReserve<T, decltype((void)std::declval<T&>().reserve(1), 0)> : std::true_type {};
 
+/*
+ * Sequential algorithms used by the terminal operations of the views. These are always called unqualified, so that iterators
+ * that can do better than a plain loop (for e.g. CartesianProductIterator) can provide a more specialized overload, found by
+ * ADL.
+ */
+template<class Iterator, class UnaryFunc>
+LZ_CONSTEXPR_CXX_20 UnaryFunc forEachImpl(Iterator begin, Iterator end, UnaryFunc func) {
+    return std::for_each(std::move(begin), std::move(end), std::move(func));
+}
+
+template<class Iterator, class OutputIterator>
+LZ_CONSTEXPR_CXX_20 OutputIterator copyImpl(Iterator begin, Iterator end, OutputIterator outputIterator) {
+    return std::copy(std::move(begin), std::move(end), std::move(outputIterator));
+}
+
+// Inserts [begin, end) at the start of container, used to create containers from views
+template<class Container, class Iterator>
+LZ_CONSTEXPR_CXX_20 void insertImpl(Container& container, Iterator begin, Iterator end) {
+    copyImpl(std::move(begin), std::move(end), std::inserter(container, container.begin()));
+}
+
+template<class Iterator, class T, class BinaryOp>
+LZ_CONSTEXPR_CXX_20 T foldlImpl(Iterator begin, Iterator end, T init, BinaryOp binaryOp) {
+    for (; begin != end; ++begin) {
+        init = binaryOp(std::move(init), *begin);
+    }
+    return init;
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 DiffType<Iterator> countImpl(Iterator begin, Iterator end, const T& value) {
+    return std::count(std::move(begin), std::move(end), value);
+}
+
+template<class Iterator, class T>
+LZ_CONSTEXPR_CXX_20 Iterator findImpl(Iterator begin, Iterator end, const T& value) {
+    return std::find(std::move(begin), std::move(end), value);
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator minElementImpl(Iterator begin, Iterator end, Compare compare) {
+    return std::min_element(std::move(begin), std::move(end), std::move(compare));
+}
+
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 Iterator maxElementImpl(Iterator begin, Iterator end, Compare compare) {
+    return std::max_element(std::move(begin), std::move(end), std::move(compare));
+}
+
+// Partially sorts [begin, end), the sequence must not be empty
+template<class Iterator, class Compare>
+LZ_CONSTEXPR_CXX_20 double medianImpl(Iterator begin, Iterator end, Compare compare) {
+    using lz::next;
+    using std::next;
+    const DiffType<Iterator> length = getIterLength(begin, end);
+    const Iterator midIter = next(begin, length / 2);
+    std::nth_element(begin, midIter, end, compare);
+    if (isEven(length)) {
+        const Iterator leftHalf = std::max_element(begin, midIter, compare);
+        return (static_cast<double>(*leftHalf) + *midIter) / 2.;
+    }
+    return *midIter;
+}
+
 template<class LzIterator>
 class BasicIteratorView {
 protected:
@@ -297,18 +361,19 @@ private:
     using KeyType = FunctionReturnType<KeySelectorFunc, RefType<LzIterator>>;
 
 #    ifndef __cpp_if_constexpr
+    // Input iterators are not reserved for, because getting their size takes an extra pass, that may yield other elements
     template<class Container>
-    EnableIf<!HasReserve<Container>::value, void> tryReserve(Container&) const {
+    EnableIf<!HasReserve<Container>::value || !IsForward<LzIterator>::value, void> tryReserve(Container&) const {
     }
 
     template<class Container>
-    EnableIf<HasReserve<Container>::value, void> tryReserve(Container& container) const {
+    EnableIf<HasReserve<Container>::value && IsForward<LzIterator>::value, void> tryReserve(Container& container) const {
         container.reserve(size());
     }
 #    else
     template<class Container>
     LZ_CONSTEXPR_CXX_20 void tryReserve(Container& container) const {
-        if constexpr (HasReserve<Container>::value) {
+        if constexpr (HasReserve<Container>::value && IsForward<LzIterator>::value) {
             container.reserve(size());
         }
     }
@@ -391,7 +456,7 @@ public:
         tryReserve(container);
         if constexpr (internal::IsSequencedPolicyV<Execution>) {
             tryReserve(container);
-            copyTo(std::inserter(container, container.begin()), execution);
+            insertImpl(container, _begin, _end);
         }
         else {
             static_assert(HasResize<Container>::value, "Container needs to have a method resize() in order to use parallel "
@@ -411,7 +476,7 @@ public:
     template<class OutputIterator, class Execution = std::execution::sequenced_policy>
     LZ_CONSTEXPR_CXX_20 void copyTo(OutputIterator outputIterator, Execution execution = std::execution::seq) const {
         if constexpr (internal::checkForwardAndPolicies<Execution, OutputIterator>()) {
-            std::copy(_begin, _end, outputIterator);
+            copyImpl(_begin, _end, outputIterator);
         }
         else {
             static_assert(IsForward<LzIterator>::value,
@@ -518,7 +583,7 @@ public:
     Container to(Args&&... args) const {
         Container cont(std::forward<Args>(args)...);
         tryReserve(cont);
-        copyTo(std::inserter(cont, cont.begin()));
+        insertImpl(cont, _begin, _end);
         return cont;
     }
 
@@ -529,7 +594,7 @@ public:
      */
     template<class OutputIterator>
     void copyTo(OutputIterator outputIterator) const {
-        std::copy(_begin, _end, outputIterator);
+        copyImpl(_begin, _end, outputIterator);
     }
 
     /**
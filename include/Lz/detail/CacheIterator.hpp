@@ -0,0 +1,157 @@
+#pragma once
+
+#ifndef LZ_CACHE_ITERATOR_HPP
+#define LZ_CACHE_ITERATOR_HPP
+
+#include "LzTools.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <memory>
+
+namespace lz {
+namespace internal {
+/**
+ * The shared state of a `lz::Cache` view. Elements of the underlying sequence are evaluated at most once and appended to a
+ * `std::deque`, which allocates in chunks, so the elements are never copied again when the buffer grows and references to them
+ * stay valid.
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Allocator>
+class CacheBuffer {
+    Iterator _iterator{};
+    Iterator _end{};
+    std::deque<ValueType<Iterator>, Allocator> _buffer;
+
+public:
+    CacheBuffer(Iterator begin, Iterator end, const Allocator& allocator) :
+        _iterator(std::move(begin)),
+        _end(std::move(end)),
+        _buffer(allocator) {
+    }
+
+    // Evaluates the underlying sequence until the element at `index` is cached. Returns false if the sequence is shorter
+    bool fill(const std::size_t index) {
+        for (; _buffer.size() <= index; ++_iterator) {
+            if (_iterator == _end) {
+                return false;
+            }
+            _buffer.push_back(*_iterator);
+        }
+        return true;
+    }
+
+    std::size_t fillAll() {
+        for (; _iterator != _end; ++_iterator) {
+            _buffer.push_back(*_iterator);
+        }
+        return _buffer.size();
+    }
+
+    const ValueType<Iterator>& operator[](const std::size_t index) const {
+        return _buffer[index];
+    }
+
+    typename std::deque<ValueType<Iterator>, Allocator>::const_iterator at(const std::size_t index) const {
+        return _buffer.begin() + static_cast<std::ptrdiff_t>(index);
+    }
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator, class Allocator>
+class CacheIterator {
+    using State = CacheBuffer<Iterator, Allocator>;
+
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ValueType<Iterator>;
+    using difference_type = DiffType<Iterator>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+private:
+    static constexpr std::size_t End = (std::numeric_limits<std::size_t>::max)();
+
+    // Shared by all copies of the iterator, so that iterators stay valid after the view is destroyed, for e.g. in `IterView`
+    // chains
+    std::shared_ptr<State> _state{};
+    // The position in the sequence, or End for the end iterator, of which the position is only known after the sequence has
+    // been evaluated
+    std::size_t _index{};
+
+    LZ_NODISCARD bool isEnd() const {
+        return _index == End || !_state->fill(_index);
+    }
+
+    LZ_NODISCARD std::size_t index() const {
+        return _index == End ? _state->fillAll() : _index;
+    }
+
+public:
+    CacheIterator(std::shared_ptr<State> state, const std::size_t index) : _state(std::move(state)), _index(index) {
+    }
+
+    static CacheIterator end(std::shared_ptr<State> state) {
+        return CacheIterator(std::move(state), End);
+    }
+
+    CacheIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        _state->fill(_index);
+        return (*_state)[_index];
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    CacheIterator& operator++() {
+        ++_index;
+        return *this;
+    }
+
+    CacheIterator operator++(int) {
+        CacheIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator==(const CacheIterator& a, const CacheIterator& b) {
+        if (a._index == End || b._index == End) {
+            return a.isEnd() && b.isEnd();
+        }
+        return a._index == b._index;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const CacheIterator& a, const CacheIterator& b) {
+        return !(a == b); // NOLINT
+    }
+
+    // Evaluates the rest of the range at once, and iterates over the buffer afterwards
+    template<class UnaryFunc>
+    friend UnaryFunc forEachImpl(const CacheIterator& begin, const CacheIterator& end, UnaryFunc func) {
+        const std::size_t last = end.index();
+        if (begin._state == nullptr || begin._index >= last) {
+            return func;
+        }
+        begin._state->fill(last - 1);
+        for (auto it = begin._state->at(begin._index), itEnd = begin._state->at(last); it != itEnd; ++it) {
+            func(*it);
+        }
+        return func;
+    }
+
+    template<class OutputIterator>
+    friend OutputIterator copyImpl(const CacheIterator& begin, const CacheIterator& end, OutputIterator output) {
+        const std::size_t last = end.index();
+        if (begin._state == nullptr || begin._index >= last) {
+            return output;
+        }
+        begin._state->fill(last - 1);
+        return std::copy(begin._state->at(begin._index), begin._state->at(last), std::move(output));
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_CACHE_ITERATOR_HPP
@@ -5,7 +5,7 @@
 
 #    include "LzTools.hpp"
 
-#    include <numeric>
+#    include <array>
 
 namespace lz {
 namespace internal {
@@ -25,6 +25,8 @@ private:
     std::tuple<Iterators...> _begin{};
     std::tuple<Iterators...> _iterator{};
     std::tuple<Iterators...> _end{};
+    std::array<difference_type, sizeof...(Iterators)> _sizes{};
+    difference_type _index{};
 
 #    ifndef __cpp_if_constexpr
     template<std::size_t I>
@@ -102,39 +104,6 @@ private:
 #            pragma warning(pop)
 #        endif // LZ_MSVC
 
-    template<std::size_t I>
-    LZ_CONSTEXPR_CXX_20 EnableIf<I == 0> operatorPlusImpl(const difference_type offset) {
-        using lz::next;
-        using std::next;
-        auto& iterator = std::get<0>(_iterator);
-        iterator = next(std::move(iterator), offset);
-    }
-
-    template<std::size_t I>
-    EnableIf<(I > 0)> operatorPlusImpl(const difference_type offset) {
-        using lz::next;
-        using std::next;
-        auto& iterator = std::get<I>(_iterator);
-        const auto& begin = std::get<I>(_begin);
-        const auto& end = std::get<I>(_end);
-        difference_type dist;
-        if (offset < 0) {
-            if (iterator == begin) {
-                iterator = end;
-                dist = getIterLength(begin, iterator);
-            }
-            else {
-                dist = getIterLength(begin, iterator) + 1;
-            }
-        }
-        else {
-            dist = getIterLength(iterator, end);
-        }
-        const auto offsets = std::lldiv(offset, dist);
-        iterator = next(std::move(iterator), static_cast<difference_type>(offsets.rem));
-        operatorPlusImpl<I - 1>(static_cast<difference_type>(offsets.quot));
-    }
-
 #    else
     template<std::size_t I>
     LZ_CONSTEXPR_CXX_20 void next() {
@@ -154,39 +123,6 @@ private:
         }
     }
 
-    template<std::size_t I>
-    void operatorPlusImpl(const difference_type offset) {
-        using lz::next;
-        using std::next;
-
-        auto& iterator = std::get<I>(_iterator);
-        if constexpr (I == 0) {
-            iterator = next(std::move(iterator), offset);
-        }
-        else {
-            using lz::next;
-            using std::next;
-            const auto& begin = std::get<I>(_begin);
-            const auto& end = std::get<I>(_end);
-            difference_type dist;
-            if (offset < 0) {
-                if (iterator == begin) {
-                    iterator = end;
-                    dist = getIterLength(begin, iterator);
-                }
-                else {
-                    dist = getIterLength(begin, iterator) + 1;
-                }
-            }
-            else {
-                dist = getIterLength(iterator, end);
-            }
-            const auto [quot, rem] = std::lldiv(offset, dist);
-            iterator = next(std::move(iterator), static_cast<difference_type>(rem));
-            operatorPlusImpl<I - 1>(static_cast<difference_type>(quot));
-        }
-    }
-
     template<std::size_t I>
     LZ_CONSTEXPR_CXX_20 void doPrev() {
         using Iter = Decay<decltype(std::get<I>(_iterator))>;
@@ -239,22 +175,61 @@ private:
     }
 
     template<std::size_t... Is>
-    LZ_CONSTEXPR_CXX_20 difference_type distanceImpl(IndexSequence<Is...>, const CartesianProductIterator& c) const {
-#    ifdef LZ_HAS_CXX_11
-        const auto mulFn = std::multiplies<difference_type>();
-#    else
-        const auto mulFn = std::multiplies<>();
-#    endif // LZ_HAS_CXX_11
-        const difference_type distances[] = { static_cast<difference_type>(
-            getIterLength(std::get<Is>(_iterator), std::get<Is>(c._iterator)))... };
-        return std::accumulate(std::begin(distances), std::end(distances), difference_type{ 1 }, mulFn);
+    LZ_CONSTEXPR_CXX_20 void decodeIndex(IndexSequence<Is...>) {
+        using lz::next;
+        using std::next;
+        difference_type offsets[sizeof...(Iterators)]{};
+        difference_type index = _index;
+        // Decodes the linear index as a mixed radix number, where the last sequence is the least significant digit
+        for (std::size_t i = sizeof...(Iterators) - 1; i > 0; --i) {
+            if (_sizes[i] == 0) {
+                _iterator = _end;
+                return;
+            }
+            offsets[i] = index % _sizes[i];
+            index /= _sizes[i];
+        }
+        if (index >= _sizes[0]) {
+            _iterator = _end;
+            return;
+        }
+        offsets[0] = index;
+        const int expand[] = { (std::get<Is>(_iterator) = next(std::get<Is>(_begin), offsets[Is]), 0)... };
+        static_cast<void>(expand);
     }
 
-    template<std::size_t... Is>
-    LZ_CONSTEXPR_CXX_20 bool lessThan(IndexSequence<Is...>, const CartesianProductIterator& c) const {
-        const bool allLessThan[] = { (std::get<Is>(_iterator) < std::get<Is>(c._iterator))... };
-        const auto end = std::end(allLessThan);
-        return std::find(std::begin(allLessThan), end, false) == end;
+    template<std::size_t I, class UnaryFunc, class... Refs>
+    LZ_CONSTEXPR_CXX_20 EnableIf<(I == sizeof...(Iterators) - 1)> nestedLoop(UnaryFunc& func, Refs&&... outer) const {
+        const auto last = std::get<I>(_end);
+        for (auto it = std::get<I>(_begin); it != last; ++it) {
+            func(reference(outer..., *it));
+        }
+    }
+
+    template<std::size_t I, class UnaryFunc, class... Refs>
+    LZ_CONSTEXPR_CXX_20 EnableIf<(I < sizeof...(Iterators) - 1)> nestedLoop(UnaryFunc& func, Refs&&... outer) const {
+        const auto last = std::get<I>(_end);
+        for (auto it = std::get<I>(_begin); it != last; ++it) {
+            nestedLoop<I + 1>(func, outer..., *it);
+        }
+    }
+
+    // Calls func for every combination if [begin, end) spans the whole product, using one plain loop per sequence, where the
+    // values of the outer sequences are dereferenced once per inner loop. Returns false otherwise
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 static bool
+    tryNestedLoop(const CartesianProductIterator& begin, const CartesianProductIterator& end, UnaryFunc& func) {
+        difference_type total = 1;
+        for (const difference_type size : begin._sizes) {
+            total *= size;
+        }
+        if (begin._index != 0 || end._index != total) {
+            return false;
+        }
+        if (total != 0) {
+            begin.template nestedLoop<0>(func);
+        }
+        return true;
     }
 
     using IndexSequenceForThis = MakeIndexSequence<sizeof...(Iterators)>;
@@ -266,13 +241,20 @@ private:
     }
 
 public:
+    using Sizes = std::array<difference_type, sizeof...(Iterators)>;
+
     constexpr CartesianProductIterator() = default;
 
-    LZ_CONSTEXPR_CXX_20
-    CartesianProductIterator(std::tuple<Iterators...> iterator, std::tuple<Iterators...> begin, std::tuple<Iterators...> end) :
+    LZ_CONSTEXPR_CXX_20 CartesianProductIterator(std::tuple<Iterators...> begin, std::tuple<Iterators...> end, const Sizes& sizes,
+                                                 const difference_type index) :
         _begin(std::move(begin)),
-        _iterator(std::move(iterator)),
-        _end(std::move(end)) {
+        _iterator(_begin),
+        _end(std::move(end)),
+        _sizes(sizes),
+        _index(index) {
+        if (_index != 0) {
+            decodeIndex(IndexSequenceForThis());
+        }
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
@@ -284,6 +266,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 CartesianProductIterator& operator++() {
+        ++_index;
         next<sizeof...(Iterators)>();
         checkEnd();
         return *this;
@@ -296,6 +279,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 CartesianProductIterator& operator--() {
+        --_index;
         previous<sizeof...(Iterators)>();
         return *this;
     }
@@ -307,8 +291,8 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 CartesianProductIterator& operator+=(const difference_type offset) {
-        operatorPlusImpl<sizeof...(Iterators) - 1>(offset);
-        checkEnd();
+        _index += offset;
+        decodeIndex(IndexSequenceForThis());
         return *this;
     }
 
@@ -328,9 +312,54 @@ public:
         return tmp;
     }
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend UnaryFunc
+    forEachImpl(CartesianProductIterator begin, CartesianProductIterator end, UnaryFunc func) {
+        if (!tryNestedLoop(begin, end, func)) {
+            for (; begin != end; ++begin) {
+                func(*begin);
+            }
+        }
+        return func;
+    }
+
+    template<class OutputIterator>
+    LZ_CONSTEXPR_CXX_20 friend OutputIterator
+    copyImpl(CartesianProductIterator begin, CartesianProductIterator end, OutputIterator outputIterator) {
+        forEachImpl(std::move(begin), std::move(end), [&outputIterator](reference value) {
+            *outputIterator = value;
+            ++outputIterator;
+        });
+        return outputIterator;
+    }
+
+    template<class T, class BinaryOp>
+    LZ_CONSTEXPR_CXX_20 friend T
+    foldlImpl(CartesianProductIterator begin, CartesianProductIterator end, T init, BinaryOp binaryOp) {
+        forEachImpl(std::move(begin), std::move(end),
+                    [&init, &binaryOp](reference value) { init = binaryOp(std::move(init), value); });
+        return init;
+    }
+
+    template<class T>
+    LZ_CONSTEXPR_CXX_20 friend difference_type
+    countImpl(CartesianProductIterator begin, CartesianProductIterator end, const T& value) {
+        difference_type count = 0;
+        forEachImpl(std::move(begin), std::move(end), [&count, &value](reference current) {
+            if (current == value) {
+                ++count;
+            }
+        });
+        return count;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
     operator==(const CartesianProductIterator& lhs, const CartesianProductIterator& rhs) noexcept {
-        return lhs._iterator == rhs._iterator;
+        return lhs._index == rhs._index;
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
@@ -339,27 +368,27 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type
-    operator-(const CartesianProductIterator& a, const CartesianProductIterator& b) {
-        return b.distanceImpl(IndexSequenceForThis(), a);
+    operator-(const CartesianProductIterator& a, const CartesianProductIterator& b) noexcept {
+        return a._index - b._index;
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
-    operator<(const CartesianProductIterator& a, const CartesianProductIterator& b) {
-        return a.lessThan(IndexSequenceForThis(), b);
+    operator<(const CartesianProductIterator& a, const CartesianProductIterator& b) noexcept {
+        return a._index < b._index;
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
-    operator>(const CartesianProductIterator& a, const CartesianProductIterator& b) {
+    operator>(const CartesianProductIterator& a, const CartesianProductIterator& b) noexcept {
         return b < a;
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
-    operator<=(const CartesianProductIterator& a, const CartesianProductIterator& b) {
+    operator<=(const CartesianProductIterator& a, const CartesianProductIterator& b) noexcept {
         return !(b < a); // NOLINT
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool
-    operator>=(const CartesianProductIterator& a, const CartesianProductIterator& b) {
+    operator>=(const CartesianProductIterator& a, const CartesianProductIterator& b) noexcept {
         return !(a < b); // NOLINT
     }
 };
@@ -0,0 +1,226 @@
+#pragma once
+
+#ifndef LZ_CHOICE_ITERATOR_HPP
+#define LZ_CHOICE_ITERATOR_HPP
+
+#include "LzTools.hpp"
+
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace lz {
+namespace internal {
+/**
+ * Walker's alias table (Vose's variant). Building takes O(n), drawing an index takes O(1) and a single uniform number, of
+ * which the integral part selects the bucket and the fractional part is the biased coin of that bucket.
+ */
+class AliasTable {
+    struct Bucket {
+        double probability{};
+        std::size_t alias{};
+    };
+
+    std::vector<Bucket> _buckets;
+
+public:
+    template<class Iterator>
+    AliasTable(Iterator begin, Iterator end) {
+        const auto size = static_cast<std::size_t>(getIterLength(begin, end));
+        LZ_ASSERT(size > 0, "weights cannot be empty");
+        _buckets.resize(size);
+
+        double total = 0;
+        for (Iterator it = begin; it != end; ++it) {
+            LZ_ASSERT(*it >= 0, "weights cannot be negative");
+            total += static_cast<double>(*it);
+        }
+        LZ_ASSERT(total > 0, "the sum of the weights must be greater than 0");
+
+        std::vector<std::size_t> small;
+        std::vector<std::size_t> large;
+        small.reserve(size);
+        large.reserve(size);
+
+        const double scale = static_cast<double>(size) / total;
+        std::size_t index = 0;
+        for (Iterator it = begin; it != end; ++it, ++index) {
+            const double probability = static_cast<double>(*it) * scale;
+            _buckets[index].probability = probability;
+            (probability < 1. ? small : large).push_back(index);
+        }
+
+        while (!small.empty() && !large.empty()) {
+            const std::size_t less = small.back();
+            small.pop_back();
+            const std::size_t more = large.back();
+
+            _buckets[less].alias = more;
+            double& moreProbability = _buckets[more].probability;
+            moreProbability = (moreProbability + _buckets[less].probability) - 1.;
+            if (moreProbability < 1.) {
+                large.pop_back();
+                small.push_back(more);
+            }
+        }
+
+        // Whatever is left over is (up to rounding errors) exactly 1
+        for (const std::size_t i : large) {
+            _buckets[i].probability = 1.;
+        }
+        for (const std::size_t i : small) {
+            _buckets[i].probability = 1.;
+        }
+    }
+
+    template<class Generator>
+    LZ_NODISCARD std::size_t operator()(Generator& generator) const {
+        constexpr std::size_t bits = std::numeric_limits<double>::digits;
+        const double scaled = std::generate_canonical<double, bits>(generator) * static_cast<double>(_buckets.size());
+        auto index = static_cast<std::size_t>(scaled);
+        if (index >= _buckets.size()) {
+            index = _buckets.size() - 1;
+        }
+        const Bucket& bucket = _buckets[index];
+        return scaled - static_cast<double>(index) < bucket.probability ? index : bucket.alias;
+    }
+
+    LZ_NODISCARD std::size_t size() const noexcept {
+        return _buckets.size();
+    }
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator, class Generator>
+class ChoiceIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+private:
+    Iterator _begin{};
+    std::shared_ptr<const AliasTable> _table{};
+    Generator* _generator{ nullptr };
+    std::ptrdiff_t _current{};
+    bool _isWhileTrueLoop{};
+
+public:
+    ChoiceIterator(Iterator begin, std::shared_ptr<const AliasTable> table, Generator& generator, const std::ptrdiff_t current,
+                   const bool isWhileTrueLoop) :
+        _begin(std::move(begin)),
+        _table(std::move(table)),
+        _generator(&generator),
+        _current(current),
+        _isWhileTrueLoop(isWhileTrueLoop) {
+    }
+
+    ChoiceIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return _begin[static_cast<difference_type>((*_table)(*_generator))];
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_NODISCARD std::size_t nextIndex() const {
+        return (*_table)(*_generator);
+    }
+
+    ChoiceIterator& operator++() noexcept {
+        if (!_isWhileTrueLoop) {
+            ++_current;
+        }
+        return *this;
+    }
+
+    ChoiceIterator operator++(int) noexcept {
+        ChoiceIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    ChoiceIterator& operator--() noexcept {
+        if (!_isWhileTrueLoop) {
+            --_current;
+        }
+        return *this;
+    }
+
+    ChoiceIterator operator--(int) noexcept {
+        ChoiceIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    ChoiceIterator& operator+=(const difference_type offset) noexcept {
+        if (!_isWhileTrueLoop) {
+            _current += offset;
+        }
+        return *this;
+    }
+
+    LZ_NODISCARD ChoiceIterator operator+(const difference_type offset) const noexcept {
+        ChoiceIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    ChoiceIterator& operator-=(const difference_type offset) noexcept {
+        if (!_isWhileTrueLoop) {
+            _current -= offset;
+        }
+        return *this;
+    }
+
+    LZ_NODISCARD ChoiceIterator operator-(const difference_type offset) const noexcept {
+        ChoiceIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend difference_type operator-(const ChoiceIterator& a, const ChoiceIterator& b) noexcept {
+        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
+        return a._current - b._current;
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD friend bool operator!=(const ChoiceIterator& a, const ChoiceIterator& b) noexcept {
+        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
+        return a._current != b._current;
+    }
+
+    LZ_NODISCARD friend bool operator==(const ChoiceIterator& a, const ChoiceIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const ChoiceIterator& a, const ChoiceIterator& b) noexcept {
+        LZ_ASSERT(a._isWhileTrueLoop == b._isWhileTrueLoop, "incompatible iterator types: both must be while true or not");
+        return a._current < b._current;
+    }
+
+    LZ_NODISCARD friend bool operator>(const ChoiceIterator& a, const ChoiceIterator& b) noexcept {
+        return b < a;
+    }
+
+    LZ_NODISCARD friend bool operator<=(const ChoiceIterator& a, const ChoiceIterator& b) noexcept {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const ChoiceIterator& a, const ChoiceIterator& b) noexcept {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif
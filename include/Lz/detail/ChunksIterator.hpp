@@ -5,8 +5,6 @@
 
 #    include "BasicIteratorView.hpp"
 
-#    include <cmath>
-
 namespace lz {
 namespace internal {
 template<class, bool>
@@ -95,6 +93,16 @@ private:
     Iterator _end{};
     difference_type _chunkSize{};
 
+    // Chunks start at a multiple of _chunkSize, so the last chunk may be shorter than the others. Only stepping back from the end
+    // needs its size, which costs a pass over the sequence if it is not random access
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type lastChunkSize() const {
+        if (_subRangeEnd != _end) {
+            return _chunkSize;
+        }
+        const auto length = getIterLength(_begin, _end);
+        return length == 0 ? 0 : (length - 1) % _chunkSize + 1;
+    }
+
 #    ifdef __cpp_if_constexpr
     LZ_CONSTEXPR_CXX_20 void nextChunk() {
         if constexpr (IsRandomAccess<Iterator>::value) {
@@ -113,15 +121,10 @@ private:
 
     LZ_CONSTEXPR_CXX_20 void prevChunk() {
         if constexpr (IsRandomAccess<Iterator>::value) {
-            if (_subRangeBegin - _begin > _chunkSize) {
-                _subRangeBegin -= _chunkSize;
-            }
-            else {
-                _subRangeBegin = _begin;
-            }
+            _subRangeBegin = _begin + ((_subRangeEnd - _begin - 1) / _chunkSize) * _chunkSize;
         }
         else {
-            for (difference_type count = _chunkSize; 0 < count && _subRangeBegin != _begin; count--, --_subRangeBegin) {
+            for (difference_type count = lastChunkSize(); 0 < count && _subRangeBegin != _begin; count--, --_subRangeBegin) {
             }
         }
     }
@@ -144,20 +147,35 @@ private:
 
     template<class I = Iterator>
     LZ_CONSTEXPR_CXX_20 EnableIf<IsRandomAccess<I>::value> prevChunk() {
-        if (_subRangeBegin - _begin > _chunkSize) {
-            _subRangeBegin -= _chunkSize;
-        }
-        else {
-            _subRangeBegin = _begin;
-        }
+        _subRangeBegin = _begin + ((_subRangeEnd - _begin - 1) / _chunkSize) * _chunkSize;
     }
 
     template<class I = Iterator>
     LZ_CONSTEXPR_CXX_20 EnableIf<!IsRandomAccess<I>::value> prevChunk() {
-        for (difference_type count = _chunkSize; 0 < count && _subRangeBegin != _begin; count--, --_subRangeBegin) {
+        for (difference_type count = lastChunkSize(); 0 < count && _subRangeBegin != _begin; count--, --_subRangeBegin) {
         }
     }
 #    endif // __cpp_if_constexpr
+
+    // Every chunk, except for the last one, starts at a multiple of _chunkSize, and the end iterator is located at the end of the
+    // sequence, so rounding up gives the index of the chunk for both cases
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type chunkIndex() const {
+        return (_subRangeBegin - _begin + _chunkSize - 1) / _chunkSize;
+    }
+
+    LZ_CONSTEXPR_CXX_20 void setChunk(const difference_type index) {
+        LZ_ASSERT(index >= 0, "cannot go before the first chunk");
+        const auto length = _end - _begin;
+        const auto offset = index * _chunkSize;
+        if (offset >= length) {
+            _subRangeBegin = _end;
+            _subRangeEnd = _end;
+            return;
+        }
+        _subRangeBegin = _begin + offset;
+        _subRangeEnd = length - offset > _chunkSize ? _subRangeBegin + _chunkSize : _end;
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 ChunksIterator(Iterator iterator, Iterator begin, Iterator end, const std::size_t chunkSize) :
         _begin(std::move(begin)),
@@ -201,7 +219,7 @@ public:
 
     LZ_CONSTEXPR_CXX_20 ChunksIterator operator--(int) {
         ChunksIterator tmp(*this);
-        ++*this;
+        --*this;
         return tmp;
     }
 
@@ -215,34 +233,7 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 ChunksIterator& operator+=(const difference_type offset) {
-        auto totalOffset = _chunkSize * offset;
-        if (offset == 0) {
-            return *this;
-        }
-        if (totalOffset < 0) {
-            auto dist = _subRangeEnd - _begin;
-            if (std::abs(totalOffset) > dist) {
-                _subRangeBegin = _begin;
-                _subRangeEnd = _begin + static_cast<difference_type>((_end - _begin) / _chunkSize);
-            }
-            else {
-                if (offset != -1 || _subRangeEnd != _end) {
-                    totalOffset += _chunkSize;
-                    _subRangeEnd += totalOffset;
-                }
-                _subRangeBegin = totalOffset >= _subRangeEnd - _begin ? _begin : _subRangeEnd + totalOffset;
-            }
-        }
-        else {
-            if (totalOffset >= _end - _subRangeBegin) {
-                _subRangeEnd = _end;
-                _subRangeBegin += _end - _subRangeBegin;
-            }
-            else {
-                _subRangeBegin += totalOffset;
-                _subRangeEnd = totalOffset >= _end - _subRangeBegin ? _end : _subRangeBegin + totalOffset;
-            }
-        }
+        setChunk(chunkIndex() + offset);
         return *this;
     }
 
@@ -264,9 +255,9 @@ public:
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const ChunksIterator& lhs, const ChunksIterator& rhs) {
         LZ_ASSERT(lhs._chunkSize == rhs._chunkSize, "incompatible iterators: different chunk sizes");
-        const auto dist = lhs._subRangeBegin - rhs._subRangeBegin;
-        return dist == 0 ? 0 : roundEven(dist, lhs._chunkSize);
+        return lhs.chunkIndex() - rhs.chunkIndex();
     }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
         return *(*this + offset);
     }
@@ -9,287 +9,216 @@
 
 namespace lz {
 namespace internal {
-#ifndef __cpp_if_constexpr
-template<class Tuple, std::size_t I, class = void>
-struct PlusPlus {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end) const {
-        if (std::get<I>(iterators) != std::get<I>(end)) {
-            ++std::get<I>(iterators);
-        }
-        else {
-            PlusPlus<Tuple, I + 1>()(iterators, end);
-        }
-    }
-};
+template<LZ_CONCEPT_ITERATOR... Iterators>
+class ConcatenateIterator {
+    using IterTuple = std::tuple<Iterators...>;
+    using FirstTupleIterator = std::iterator_traits<TupleElement<0, IterTuple>>;
 
-template<class Tuple, std::size_t I>
-struct PlusPlus<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value>> {
-    LZ_CONSTEXPR_CXX_20 void operator()(const Tuple& /*iterators*/, const Tuple& /*end*/) const {
-    }
-};
+public:
+    using value_type = typename FirstTupleIterator::value_type;
+    using difference_type = typename std::common_type<DiffType<Iterators>...>::type;
+    using reference = typename FirstTupleIterator::reference;
+    using pointer = FakePointerProxy<reference>;
+    using iterator_category = typename std::common_type<IterCat<Iterators>...>::type;
 
-template<class Tuple, std::size_t I, class = void>
-struct NotEqual {
-    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end) const noexcept {
-        const bool iterHasValue = std::get<I>(iterators) != std::get<I>(end);
-        return iterHasValue ? iterHasValue : NotEqual<Tuple, I + 1>()(iterators, end);
-    }
-};
+private:
+    static constexpr std::size_t Size = sizeof...(Iterators);
+    using Indices = MakeIndexSequence<Size>;
 
-template<class Tuple, std::size_t I>
-struct NotEqual<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
-    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end) const noexcept {
-        return std::get<I>(iterators) != std::get<I>(end);
-    }
-};
+    IterTuple _iterators{};
+    IterTuple _begin{};
+    IterTuple _end{};
+    // The first non empty sequence that has not been fully iterated over yet, or Size if the iterator is at its end. Only the
+    // iterator of this sequence is kept up to date, the others are (re)set when the iterator moves to that sequence
+    std::size_t _segment{};
 
-template<class Tuple, std::size_t I, class = void>
-struct Deref {
-    LZ_CONSTEXPR_CXX_20 auto operator()(const Tuple& iterators, const Tuple& end) const -> decltype(*std::get<I>(iterators)) {
-        return std::get<I>(iterators) != std::get<I>(end) ? *std::get<I>(iterators) : Deref<Tuple, I + 1>()(iterators, end);
-    }
-};
+    template<std::size_t I>
+    using Index = std::integral_constant<std::size_t, I>;
 
-template<class Tuple, std::size_t I>
-struct Deref<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
-    LZ_CONSTEXPR_CXX_20 auto operator()(const Tuple& iterators, const Tuple&) const -> decltype(*std::get<I>(iterators)) {
-        return *std::get<I>(iterators);
+    template<class Visitor, std::size_t I>
+    using VisitResult = decltype(std::declval<Visitor&>()(Index<I>()));
+
+    template<class Visitor, std::size_t I>
+    LZ_CONSTEXPR_CXX_20 static VisitResult<Visitor, I>
+    visit(const std::size_t /* segment */, Visitor& visitor, Index<I> index, std::true_type /* isLast */) {
+        return visitor(index);
     }
-};
 
-template<class Tuple, std::size_t I>
-struct MinusMinus {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& begin, const Tuple& end) const {
-        auto& current = std::get<I>(iterators);
-        if (current != std::get<I>(begin)) {
-            --current;
-        }
-        else {
-            MinusMinus<Tuple, I - 1>()(iterators, begin, end);
+    template<class Visitor, std::size_t I>
+    LZ_CONSTEXPR_CXX_20 static VisitResult<Visitor, I>
+    visit(const std::size_t segment, Visitor& visitor, Index<I> index, std::false_type /* isLast */) {
+        if (segment == I) {
+            return visitor(index);
         }
+        return visit(segment, visitor, Index<I + 1>(), std::integral_constant<bool, I + 2 == Size>());
     }
-};
 
-template<class Tuple>
-struct MinusMinus<Tuple, 0> {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple&, const Tuple&) const {
-        --std::get<0>(iterators);
+    // Calls visitor(Index<segment>()), so that only the sequence at position `segment` is touched,
+    // instead of checking all the sequences before it. The comparisons against `segment` are compiled to a jump table
+    template<class Visitor>
+    LZ_CONSTEXPR_CXX_20 static VisitResult<Visitor, 0> visit(const std::size_t segment, Visitor visitor) {
+        return visit(segment, visitor, Index<0>(), std::integral_constant<bool, Size == 1>());
     }
-};
 
-template<class Tuple, std::size_t I>
-struct MinIs {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void
-    operator()(Tuple& iterators, const Tuple& begin, const Tuple& end, const DifferenceType offset) const {
-        using TupElem = TupleElement<I, Tuple>;
-        const TupElem current = std::get<I>(iterators);
-        const TupElem currentBegin = std::get<I>(begin);
-        // Current is begin, move on to next iterator
-        if (current == currentBegin) {
-            MinIs<Tuple, I - 1>()(iterators, begin, end, offset);
+    // The visitors below are called with the position of the current sequence, see `visit`
+
+    // Resets the sequence to its beginning. Returns false if it is empty
+    struct ResetToBegin {
+        ConcatenateIterator* self;
+
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 bool operator()(Index<I>) const {
+            std::get<I>(self->_iterators) = std::get<I>(self->_begin);
+            return std::get<I>(self->_begin) != std::get<I>(self->_end);
         }
-        else {
-            const auto dist = std::get<I>(end) - current;
-            if (dist <= offset) {
-                std::get<I>(iterators) = std::get<I>(begin);
-                MinIs<Tuple, I - 1>()(iterators, begin, end, dist == 0 ? DifferenceType{ 1 } : offset - dist);
-            }
-            else {
-                std::get<I>(iterators) -= offset;
+    };
+
+    // Resets the sequence to its last element. Returns false if it is empty
+    struct ResetToLast {
+        ConcatenateIterator* self;
+
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 bool operator()(Index<I>) const {
+            auto& current = std::get<I>(self->_iterators);
+            current = std::get<I>(self->_end);
+            if (current == std::get<I>(self->_begin)) {
+                return false;
             }
+            --current;
+            return true;
         }
-    }
-};
+    };
 
-template<class Tuple>
-struct MinIs<Tuple, 0> {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void
-    operator()(Tuple& iterators, const Tuple& /* begin */, const Tuple& /*end*/, const DifferenceType offset) const {
-        using TupElem = TupleElement<0, Tuple>;
-        TupElem& current = std::get<0>(iterators);
-        current -= offset;
-    }
-};
+    // Returns false if the sequence has been fully iterated over
+    struct HasNext {
+        const ConcatenateIterator* self;
 
-template<class Tuple, std::size_t I, class = void>
-struct PlusIs {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end, const DifferenceType offset) const {
-        using TupElem = TupleElement<I, Tuple>;
-        TupElem& currentIterator = std::get<I>(iterators);
-        const TupElem currentEnd = std::get<I>(end);
-        const auto dist = currentEnd - currentIterator;
-        if (dist > offset) {
-            currentIterator += offset;
-        }
-        else {
-            // Moves to end
-            currentIterator += dist;
-            PlusIs<Tuple, I + 1>()(iterators, end, offset - dist);
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 bool operator()(Index<I>) const {
+            return std::get<I>(self->_iterators) != std::get<I>(self->_end);
         }
-    }
-};
+    };
 
-template<class Tuple, std::size_t I>
-struct PlusIs<Tuple, I, EnableIf<I == std::tuple_size<Decay<Tuple>>::value - 1>> {
-    template<class DifferenceType>
-    constexpr void operator()(Tuple& /*iterators*/, const Tuple& /*end*/, const DifferenceType /*offset*/) const {
-    }
-};
-#else
-template<class Tuple, std::size_t I>
-struct PlusPlus {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end) const {
-        if constexpr (I == std::tuple_size_v<Decay<Tuple>>) {
-            static_cast<void>(iterators);
-            static_cast<void>(end);
-            return;
+    // Increments the iterator of the sequence. Returns false if the sequence has been fully iterated over afterwards
+    struct Increment {
+        ConcatenateIterator* self;
+
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 bool operator()(Index<I>) const {
+            return ++std::get<I>(self->_iterators) != std::get<I>(self->_end);
         }
-        else {
-            if (std::get<I>(iterators) != std::get<I>(end)) {
-                ++std::get<I>(iterators);
-            }
-            else {
-                PlusPlus<Tuple, I + 1>()(iterators, end);
+    };
+
+    // Decrements the iterator of the sequence. Returns false if it is at the beginning of the sequence
+    struct Decrement {
+        ConcatenateIterator* self;
+
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 bool operator()(Index<I>) const {
+            auto& current = std::get<I>(self->_iterators);
+            if (current == std::get<I>(self->_begin)) {
+                return false;
             }
+            --current;
+            return true;
         }
-    }
-};
+    };
 
-template<class Tuple, std::size_t I>
-struct NotEqual {
-    LZ_CONSTEXPR_CXX_20 bool operator()(const Tuple& iterators, const Tuple& end) const {
-        if constexpr (I == std::tuple_size_v<Decay<Tuple>> - 1) {
-            return std::get<I>(iterators) != std::get<I>(end);
-        }
-        else {
-            const bool iterHasValue = std::get<I>(iterators) != std::get<I>(end);
-            return iterHasValue ? iterHasValue : NotEqual<Tuple, I + 1>()(iterators, end);
-        }
-    }
-};
+    struct Dereference {
+        const ConcatenateIterator* self;
 
-template<class Tuple, std::size_t I>
-struct Deref {
-    LZ_CONSTEXPR_CXX_20 auto operator()(const Tuple& iterators, const Tuple& end) const -> decltype(*std::get<I>(iterators)) {
-        if constexpr (I == std::tuple_size_v<Decay<Tuple>> - 1) {
-            static_cast<void>(end);
-            return *std::get<I>(iterators);
-        }
-        else {
-            return std::get<I>(iterators) != std::get<I>(end) ? *std::get<I>(iterators) : Deref<Tuple, I + 1>()(iterators, end);
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 reference operator()(Index<I>) const {
+            return *std::get<I>(self->_iterators);
         }
-    }
-};
+    };
+
+    // The amount of elements before the iterator of the sequence
+    struct OffsetInSegment {
+        const ConcatenateIterator* self;
 
-template<class Tuple, std::size_t I>
-struct MinusMinus {
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& begin, const Tuple& end) const {
-        if constexpr (I == 0) {
-            static_cast<void>(begin);
-            static_cast<void>(end);
-            --std::get<0>(iterators);
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 difference_type operator()(Index<I>) const {
+            return static_cast<difference_type>(std::get<I>(self->_iterators) - std::get<I>(self->_begin));
         }
-        else {
-            auto& current = std::get<I>(iterators);
-            if (current != std::get<I>(begin)) {
-                --current;
-            }
-            else {
-                MinusMinus<Tuple, I - 1>()(iterators, begin, end);
-            }
+    };
+
+    // Moves the iterator of the sequence to the element at `offset`
+    struct MoveInSegment {
+        ConcatenateIterator* self;
+        difference_type offset;
+
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 void operator()(Index<I>) const {
+            std::get<I>(self->_iterators) = std::get<I>(self->_begin) + offset;
         }
-    }
-};
+    };
 
-template<class Tuple, std::size_t I>
-struct MinIs {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void
-    operator()(Tuple& iterators, const Tuple& begin, const Tuple& end, const DifferenceType offset) const {
-        using TupElem = TupleElement<I, Tuple>;
-
-        if constexpr (I == 0) {
-            static_cast<void>(begin);
-            static_cast<void>(end);
-            TupElem& current = std::get<0>(iterators);
-            current -= offset;
+    struct NotEqual {
+        const ConcatenateIterator* a;
+        const ConcatenateIterator* b;
+
+        template<std::size_t I>
+        LZ_CONSTEXPR_CXX_20 bool operator()(Index<I>) const {
+            return std::get<I>(a->_iterators) != std::get<I>(b->_iterators);
         }
-        else {
-            const TupElem currentBegin = std::get<I>(begin);
-            const TupElem current = std::get<I>(iterators);
-            // Current is begin, move on to next iterator
-            if (current == currentBegin) {
-                MinIs<Tuple, I - 1>()(iterators, begin, end, offset);
-            }
-            else {
-                const auto dist = std::get<I>(end) - current;
-                if (dist <= offset) {
-                    std::get<I>(iterators) = std::get<I>(begin);
-                    MinIs<Tuple, I - 1>()(iterators, begin, end, dist == 0 ? DifferenceType{ 1 } : offset - dist);
-                }
-                else {
-                    std::get<I>(iterators) -= offset;
-                }
+    };
+
+    // Moves to the first non empty sequence after the current one
+    LZ_CONSTEXPR_CXX_20 void toNextSegment() {
+        for (++_segment; _segment != Size; ++_segment) {
+            const bool hasSome = visit(_segment, ResetToBegin{ this });
+            if (hasSome) {
+                return;
             }
         }
     }
-};
 
-template<class Tuple, std::size_t I>
-struct PlusIs {
-    template<class DifferenceType>
-    LZ_CONSTEXPR_CXX_20 void operator()(Tuple& iterators, const Tuple& end, const DifferenceType offset) const {
-        using lz::distance;
-        using std::distance;
-        if constexpr (I == std::tuple_size_v<Decay<Tuple>> - 1) {
-            static_cast<void>(iterators);
-            static_cast<void>(end);
-            static_cast<void>(offset);
-            return;
-        }
-        else {
-            using TupElem = TupleElement<I, Tuple>;
-            TupElem& currentIterator = std::get<I>(iterators);
-            const TupElem currentEnd = std::get<I>(end);
-            const auto dist = currentEnd - currentIterator;
-            if (dist > offset) {
-                currentIterator += offset;
-            }
-            else {
-                // Moves to end
-                currentIterator += dist;
-                PlusIs<Tuple, I + 1>()(iterators, end, offset - dist);
+    // Moves to the last element of the first non empty sequence before the current one
+    LZ_CONSTEXPR_CXX_20 void toPreviousSegment() {
+        while (_segment != 0) {
+            --_segment;
+            const bool hasSome = visit(_segment, ResetToLast{ this });
+            if (hasSome) {
+                return;
             }
         }
     }
-};
-#endif // __cpp_if_constexpr
 
-template<LZ_CONCEPT_ITERATOR... Iterators>
-class ConcatenateIterator {
-    using IterTuple = std::tuple<Iterators...>;
-    IterTuple _iterators{};
-    IterTuple _begin{};
-    IterTuple _end{};
-
-    using FirstTupleIterator = std::iterator_traits<TupleElement<0, IterTuple>>;
-
-public:
-    using value_type = typename FirstTupleIterator::value_type;
-    using difference_type = typename std::common_type<DiffType<Iterators>...>::type;
-    using reference = typename FirstTupleIterator::reference;
-    using pointer = FakePointerProxy<reference>;
-    using iterator_category = typename std::common_type<IterCat<Iterators>...>::type;
+    template<std::size_t I>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type length() const {
+        return static_cast<difference_type>(std::get<I>(_end) - std::get<I>(_begin));
+    }
 
-private:
-    template<std::size_t... I>
-    LZ_CONSTEXPR_CXX_20 difference_type minus(IndexSequence<I...>, const ConcatenateIterator& other) const {
-        const difference_type totals[] = { static_cast<difference_type>(std::get<I>(_iterators) -
-                                                                        std::get<I>(other._iterators))... };
-        return std::accumulate(std::begin(totals), std::end(totals), difference_type{ 0 });
+    // The amount of elements before the current position. The lengths of all sequences before the current one are summed without
+    // branching, which for the small amount of sequences is cheaper than storing the prefix sums in every iterator copy
+    template<std::size_t... Is>
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type position(IndexSequence<Is...>) const {
+        const difference_type lengths[] = { (Is < _segment ? length<Is>() : 0)... };
+        const auto before = std::accumulate(std::begin(lengths), std::end(lengths), difference_type{ 0 });
+        if (_segment == Size) {
+            return before;
+        }
+        return before + visit(_segment, OffsetInSegment{ this });
+    }
+
+    // Moves to the element at `target`. The new sequence is the last one that starts at or before `target`, which is found by
+    // counting the running sums of the lengths that are <= target. Empty sequences start at the same position as the sequence
+    // after them, so they are skipped automatically
+    template<std::size_t... Is>
+    LZ_CONSTEXPR_CXX_20 void moveTo(const difference_type target, IndexSequence<Is...>) {
+        difference_type sum = 0;
+        difference_type before = 0;
+        std::size_t segment = 0;
+        const bool expand[] = { (sum += length<Is>(), segment += static_cast<std::size_t>(sum <= target),
+                                 before = sum <= target ? sum : before, true)... };
+        static_cast<void>(expand);
+        _segment = segment;
+        if (_segment == Size) {
+            return;
+        }
+        const auto offsetInSegment = target - before;
+        visit(_segment, MoveInSegment{ this, offsetInSegment });
     }
 
 public:
@@ -297,12 +226,18 @@ public:
         _iterators(std::move(iterators)),
         _begin(std::move(begin)),
         _end(std::move(end)) {
+        for (; _segment != Size; ++_segment) {
+            const bool hasSome = visit(_segment, HasNext{ this });
+            if (hasSome) {
+                return;
+            }
+        }
     }
 
     constexpr ConcatenateIterator() = default;
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
-        return Deref<IterTuple, 0>()(_iterators, _end);
+        return visit(_segment, Dereference{ this });
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
@@ -310,7 +245,10 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator& operator++() {
-        PlusPlus<IterTuple, 0>()(_iterators, _end);
+        const bool hasSome = visit(_segment, Increment{ this });
+        if (!hasSome) {
+            toNextSegment();
+        }
         return *this;
     }
 
@@ -321,24 +259,29 @@ public:
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator& operator--() {
-        MinusMinus<IterTuple, sizeof...(Iterators) - 1>()(_iterators, _begin, _end);
+        if (_segment != Size) {
+            const bool decremented = visit(_segment, Decrement{ this });
+            if (decremented) {
+                return *this;
+            }
+        }
+        toPreviousSegment();
         return *this;
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator operator--(int) {
         ConcatenateIterator tmp(*this);
-        ++*this;
+        --*this;
         return tmp;
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator& operator+=(const difference_type offset) {
-        PlusIs<IterTuple, 0>()(_iterators, _end, offset);
+        moveTo(position(Indices()) + offset, Indices());
         return *this;
     }
 
     LZ_CONSTEXPR_CXX_20 ConcatenateIterator& operator-=(const difference_type offset) {
-        MinIs<IterTuple, sizeof...(Iterators) - 1>()(_iterators, _begin, _end, offset);
-        return *this;
+        return *this += -offset;
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ConcatenateIterator operator+(const difference_type offset) const {
@@ -354,14 +297,20 @@ public:
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const ConcatenateIterator& other) const {
-        return minus(MakeIndexSequence<sizeof...(Iterators)>(), other);
+        return position(Indices()) - other.position(Indices());
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const ConcatenateIterator& a, const ConcatenateIterator& b) noexcept {
-        return NotEqual<IterTuple, 0>()(a._iterators, b._iterators);
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const ConcatenateIterator& a, const ConcatenateIterator& b) {
+        if (a._segment != b._segment) {
+            return true;
+        }
+        if (a._segment == Size) {
+            return false;
+        }
+        return visit(a._segment, NotEqual{ &a, &b });
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const ConcatenateIterator& a, const ConcatenateIterator& b) noexcept {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const ConcatenateIterator& a, const ConcatenateIterator& b) {
         return !(a != b); // NOLINT
     }
 
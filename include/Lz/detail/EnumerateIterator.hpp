@@ -15,7 +15,9 @@ class EnumerateIterator {
     using IterTraits = std::iterator_traits<Iterator>;
 
 public:
-    using iterator_category = typename IterTraits::iterator_category;
+    // The index of the end iterator is only known for random access iterators, so other iterators can only be incremented
+    using iterator_category = Conditional<IsRandomAccess<Iterator>::value, typename IterTraits::iterator_category,
+                                          typename std::common_type<std::forward_iterator_tag, IterCat<Iterator>>::type>;
     using value_type = std::pair<Arithmetic, typename IterTraits::value_type>;
     using difference_type = typename IterTraits::difference_type;
     using reference = std::pair<Arithmetic, typename IterTraits::reference>;
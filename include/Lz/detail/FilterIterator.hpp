@@ -10,12 +10,72 @@
 
 namespace lz {
 namespace internal {
+/**
+ * The conjunction `first(x) && second(x)` of two predicates, used to fuse a filter of a filter into a single filter, so that the
+ * sequence is only iterated over by a single iterator.
+ */
+template<class First, class Second>
+class ConjunctionPredicate {
+    FunctionContainer<First> _first{};
+    FunctionContainer<Second> _second{};
+
+public:
+    ConjunctionPredicate(const FunctionContainer<First>& first, Second second) : _first(first), _second(std::move(second)) {
+    }
+
+    ConjunctionPredicate() = default;
+
+    template<class T>
+    bool operator()(T&& value) const {
+        return _first(value) && _second(value);
+    }
+};
+
+/**
+ * Whether a filter iterator caches the value of the element it points to. This is the case if the underlying iterator returns
+ * its values by value, for e.g. a `lz::map`, so that the mapping function is called once for every element, instead of once for
+ * the predicate and once more when the filter iterator is dereferenced. Only real values are cached: proxy references, for
+ * e.g. the ones of `std::vector<bool>`, refer to their container and therefore differ from the value type of the iterator.
+ */
+template<class Iterator, class UnaryPredicate, class = int>
+struct IsFilterCached : std::false_type {};
+
+template<class Iterator, class UnaryPredicate>
+struct IsFilterCached<Iterator, UnaryPredicate,
+                      decltype((void)std::declval<const UnaryPredicate&>()(std::declval<ValueType<Iterator>&>()), 0)>
+    : std::integral_constant<bool, std::is_same<RefType<Iterator>, ValueType<Iterator>>::value &&
+                                       std::is_default_constructible<ValueType<Iterator>>::value &&
+                                       std::is_move_assignable<ValueType<Iterator>>::value> {};
+
+// Holds the value of the element a filter iterator points to, if it is cached. Empty otherwise, so that it does not take space
+// as a base class
+template<class T, bool IsCached>
+struct FilterCache {};
+
+template<class T>
+struct FilterCache<T, true> {
+    T _cachedValue{};
+};
+
 #ifdef LZ_HAS_EXECUTION
+template<class Iterator, class UnaryPredicate, class Execution>
+using FilterCacheFor =
+    FilterCache<Decay<RefType<Iterator>>,
+                IsSequencedPolicy<Execution>::value && IsFilterCached<Iterator, UnaryPredicate>::value>;
+
 template<LZ_CONCEPT_ITERATOR Iterator, class UnaryPredicate, class Execution>
+class FilterIterator : private FilterCacheFor<Iterator, UnaryPredicate, Execution> {
+    // Parallel searches do not cache the values they find
+    using IsCached = std::integral_constant<bool, IsSequencedPolicy<Execution>::value &&
+                                                      IsFilterCached<Iterator, UnaryPredicate>::value>;
 #else  // ^^^lz has execution vvv ! lz has execution
+template<class Iterator, class UnaryPredicate>
+using FilterCacheFor = FilterCache<Decay<RefType<Iterator>>, IsFilterCached<Iterator, UnaryPredicate>::value>;
+
 template<LZ_CONCEPT_ITERATOR Iterator, class UnaryPredicate>
+class FilterIterator : private FilterCacheFor<Iterator, UnaryPredicate> {
+    using IsCached = IsFilterCached<Iterator, UnaryPredicate>;
 #endif // LZ_HAS_EXECUTION
-class FilterIterator {
     using IterTraits = std::iterator_traits<Iterator>;
 
 public:
@@ -29,17 +89,42 @@ public:
     LZ_CONSTEXPR_CXX_20 I find(I first, I last) {
 #ifdef LZ_HAS_EXECUTION
         if constexpr (internal::checkForwardAndPolicies<Execution, Iterator>()) {
-            return std::find_if(std::move(first), std::move(last), _predicate);
+            return findSequenced(std::move(first), std::move(last), IsCached());
         }
         else {
             return std::find_if(_execution, std::move(first), std::move(last), _predicate);
         }
 #else  // ^^^lz has execution vvv ! lz has execution
-        return std::find_if(std::move(first), std::move(last), _predicate);
+        return findSequenced(std::move(first), std::move(last), IsCached());
 #endif // LZ_HAS_EXECUTION
     }
 
 private:
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 I findSequenced(I first, I last, std::false_type /* isCached */) {
+        return std::find_if(std::move(first), std::move(last), _predicate);
+    }
+
+    // Every element is evaluated once, into the cache, after which the predicate is called with the cached value
+    template<class I>
+    LZ_CONSTEXPR_CXX_20 I findSequenced(I first, I last, std::true_type /* isCached */) {
+        for (; first != last; ++first) {
+            this->_cachedValue = *first;
+            if (_predicate(this->_cachedValue)) {
+                break;
+            }
+        }
+        return first;
+    }
+
+    LZ_CONSTEXPR_CXX_20 reference dereference(std::false_type /* isCached */) const {
+        return *_iterator;
+    }
+
+    LZ_CONSTEXPR_CXX_20 reference dereference(std::true_type /* isCached */) const {
+        return this->_cachedValue;
+    }
+
     Iterator _begin{};
     Iterator _iterator{};
     Iterator _end{};
@@ -72,8 +157,16 @@ public:
 
     constexpr FilterIterator() = default;
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 const Iterator& base() const noexcept {
+        return _iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 const FunctionContainer<UnaryPredicate>& predicate() const noexcept {
+        return _predicate;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
-        return *_iterator;
+        return dereference(IsCached());
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
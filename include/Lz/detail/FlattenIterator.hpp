@@ -3,7 +3,9 @@
 #ifndef LZ_FLATTEN_ITERATOR_HPP
 #define LZ_FLATTEN_ITERATOR_HPP
 
-#include "LzTools.hpp"
+#include "BasicIteratorView.hpp"
+
+#include <functional>
 
 namespace lz {
 namespace internal {
@@ -114,6 +116,10 @@ public:
         _current = _end;
     }
 
+    LZ_CONSTEXPR_CXX_20 Iterator current() const {
+        return _current;
+    }
+
     LZ_CONSTEXPR_CXX_20 bool hasSome() const noexcept {
         return _current != _end;
     }
@@ -188,6 +194,37 @@ private:
        _innerIter = {};
     }
 
+    template<class Container>
+    LZ_CONSTEXPR_CXX_20 static Inner innerBegin(Container&& container) {
+        const auto begin = std::begin(container);
+        return { begin, begin, std::end(container) };
+    }
+
+    template<class Container>
+    LZ_CONSTEXPR_CXX_20 static Inner innerEnd(Container&& container) {
+        const auto end = std::end(container);
+        return { end, std::begin(container), end };
+    }
+
+    // Calls `func(first, last)` for every inner range that [begin, end) consists of, so that the inner ranges can be processed
+    // without checking the outer iterator for every element
+    template<class BinaryFunc>
+    LZ_CONSTEXPR_CXX_20 static void forEachInner(FlattenIterator begin, const FlattenIterator& end, BinaryFunc func) {
+        if (begin._outerIter == end._outerIter) {
+            if (begin.hasSome()) {
+                func(begin._innerIter, end._innerIter);
+            }
+            return;
+        }
+        func(begin._innerIter, innerEnd(*begin._outerIter));
+        for (++begin._outerIter; begin._outerIter != end._outerIter; ++begin._outerIter) {
+            func(innerBegin(*begin._outerIter), innerEnd(*begin._outerIter));
+        }
+        if (end.hasSome()) {
+            func(innerBegin(*end._outerIter), end._innerIter);
+        }
+    }
+
     FlattenWrapper<Iterator> _outerIter{};
     Inner _innerIter{};
 
@@ -261,6 +298,29 @@ public:
         --*this;
         return tmp;
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type distance(const FlattenIterator& begin, const FlattenIterator& end) {
+        difference_type result = 0;
+        forEachInner(begin, end, [&result](const Inner& first, const Inner& last) { result += distance(first, last); });
+        return result;
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend UnaryFunc forEachImpl(FlattenIterator begin, FlattenIterator end, UnaryFunc func) {
+        forEachInner(std::move(begin), end, [&func](const Inner& first, const Inner& last) {
+            forEachImpl(first, last, std::ref(func));
+        });
+        return func;
+    }
+
+    template<class OutputIterator>
+    LZ_CONSTEXPR_CXX_20 friend OutputIterator
+    copyImpl(FlattenIterator begin, FlattenIterator end, OutputIterator outputIterator) {
+        forEachInner(std::move(begin), end, [&outputIterator](const Inner& first, const Inner& last) {
+            outputIterator = copyImpl(first, last, std::move(outputIterator));
+        });
+        return outputIterator;
+    }
 };
 
 template<class Iterator>
@@ -327,6 +387,21 @@ public:
         --*this;
         return tmp;
     }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type distance(const FlattenIterator& begin, const FlattenIterator& end) {
+        return getIterLength(begin._range.current(), end._range.current());
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend UnaryFunc forEachImpl(const FlattenIterator& begin, const FlattenIterator& end, UnaryFunc func) {
+        return forEachImpl(begin._range.current(), end._range.current(), std::move(func));
+    }
+
+    template<class OutputIterator>
+    LZ_CONSTEXPR_CXX_20 friend OutputIterator
+    copyImpl(const FlattenIterator& begin, const FlattenIterator& end, OutputIterator outputIterator) {
+        return copyImpl(begin._range.current(), end._range.current(), std::move(outputIterator));
+    }
 };
 } // namespace internal
 } // namespace lz
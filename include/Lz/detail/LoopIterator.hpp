@@ -6,9 +6,14 @@
 
 #    include "LzTools.hpp"
 
+#    include <algorithm>
+
 namespace lz { namespace internal {
+template<class Iterator, bool /* isInfinite */>
+class LoopIterator;
+
 template<class Iterator>
-class LoopIterator {
+class LoopIterator<Iterator, true /* isInfinite */> {
     using IterTraits = std::iterator_traits<Iterator>;
 
     Iterator _begin{};
@@ -120,6 +125,190 @@ public:
         return true;
     }
 };
+
+template<class Iterator>
+class LoopIterator<Iterator, false /* isInfinite */> {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+    Iterator _begin{};
+    Iterator _iterator{};
+    Iterator _end{};
+    // The amount of times the sequence has been fully iterated over
+    typename IterTraits::difference_type _rotation{};
+
+public:
+    using reference = typename IterTraits::reference;
+    using value_type = typename IterTraits::value_type;
+    using pointer = FakePointerProxy<reference>;
+    using difference_type = typename IterTraits::difference_type;
+    using iterator_category = typename std::common_type<std::bidirectional_iterator_tag, IterCat<Iterator>>::type;
+
+private:
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type position() const {
+        return _rotation * (_end - _begin) + (_iterator - _begin);
+    }
+
+    // Calls segmentFunc(first, last) for every part of the underlying sequence in [a, b): the rest of the current round, the
+    // full rounds in between and the start of the last round
+    template<class SegmentFunc>
+    LZ_CONSTEXPR_CXX_20 static void forEachSegment(const LoopIterator& a, const LoopIterator& b, SegmentFunc& segmentFunc) {
+        if (a._rotation == b._rotation) {
+            segmentFunc(a._iterator, b._iterator);
+            return;
+        }
+        segmentFunc(a._iterator, a._end);
+        for (difference_type rotation = a._rotation + 1; rotation < b._rotation; ++rotation) {
+            segmentFunc(a._begin, a._end);
+        }
+        segmentFunc(a._begin, b._iterator);
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 LoopIterator(Iterator iterator, Iterator begin, Iterator end, const difference_type rotation) :
+        _begin(std::move(begin)),
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _rotation(rotation) {
+    }
+
+    constexpr LoopIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 LoopIterator& operator++() {
+        ++_iterator;
+        if (_iterator == _end) {
+            _iterator = _begin;
+            ++_rotation;
+        }
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 LoopIterator operator++(int) {
+        LoopIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 LoopIterator& operator--() {
+        if (_iterator == _begin) {
+            _iterator = _end;
+            --_rotation;
+        }
+        --_iterator;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 LoopIterator operator--(int) {
+        LoopIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 LoopIterator& operator+=(const difference_type offset) {
+        const auto length = _end - _begin;
+        const auto target = position() + offset;
+        _rotation = target / length;
+        _iterator = _begin + target % length;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 LoopIterator& operator-=(const difference_type offset) {
+        return *this += -offset;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 LoopIterator operator+(const difference_type offset) const {
+        LoopIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 LoopIterator operator-(const difference_type offset) const {
+        LoopIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type operator-(const LoopIterator& a, const LoopIterator& b) {
+        return a.position() - b.position();
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    // The length of the underlying sequence is only computed once, instead of walking it for every round
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type distance(const LoopIterator& a, const LoopIterator& b) {
+        if (a._rotation == b._rotation) {
+            return getIterLength(a._iterator, b._iterator);
+        }
+        return (b._rotation - a._rotation) * getIterLength(a._begin, a._end) + getIterLength(a._begin, b._iterator) -
+               getIterLength(a._begin, a._iterator);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const LoopIterator& a, const LoopIterator& b) {
+        return a._rotation != b._rotation || a._iterator != b._iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const LoopIterator& a, const LoopIterator& b) {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const LoopIterator& a, const LoopIterator& b) {
+        return a - b < 0;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const LoopIterator& a, const LoopIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const LoopIterator& a, const LoopIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const LoopIterator& a, const LoopIterator& b) {
+        return !(a < b); // NOLINT
+    }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend UnaryFunc forEachImpl(const LoopIterator& begin, const LoopIterator& end, UnaryFunc func) {
+        auto segmentFunc = [&func](Iterator first, const Iterator last) {
+            for (; first != last; ++first) {
+                func(*first);
+            }
+        };
+        forEachSegment(begin, end, segmentFunc);
+        return func;
+    }
+
+    // Every round is copied using std::copy, which copies trivially copyable contiguous data using memmove
+    template<class OutputIterator>
+    LZ_CONSTEXPR_CXX_20 friend OutputIterator
+    copyImpl(const LoopIterator& begin, const LoopIterator& end, OutputIterator outputIterator) {
+        auto segmentFunc = [&outputIterator](const Iterator first, const Iterator last) {
+            outputIterator = std::copy(first, last, std::move(outputIterator));
+        };
+        forEachSegment(begin, end, segmentFunc);
+        return outputIterator;
+    }
+
+    // Containers such as std::vector insert every round at once, instead of inserting the values one by one
+    template<class Container>
+    LZ_CONSTEXPR_CXX_20 friend auto insertImpl(Container& container, const LoopIterator& begin, const LoopIterator& end)
+        -> decltype(void(container.insert(container.begin(), std::declval<Iterator>(), std::declval<Iterator>()))) {
+        auto position = container.begin();
+        auto segmentFunc = [&container, &position](const Iterator first, const Iterator last) {
+            position = std::next(container.insert(position, first, last), getIterLength(first, last));
+        };
+        forEachSegment(begin, end, segmentFunc);
+    }
+};
 }}
 
 #endif // LZ_LOOP_ITERATOR_HPP
\ No newline at end of file
@@ -3,8 +3,11 @@
 #ifndef LZ_LZ_TOOLS_HPP
 #    define LZ_LZ_TOOLS_HPP
 
+#    include <cstdint>
 #    include <iterator>
+#    include <string>
 #    include <tuple>
+#    include <vector>
 
 #    if defined(__has_include)
 #        define LZ_HAS_INCLUDE(FILE) __has_include(FILE)
@@ -355,11 +358,45 @@ struct IsForward : std::is_convertible<IterCat<Iterator>, std::forward_iterator_
 template<class Iterator>
 struct IsRandomAccess : std::is_convertible<IterCat<Iterator>, std::random_access_iterator_tag> {};
 
+#    ifdef LZ_HAS_CONCEPTS
+template<class Iterator>
+struct IsContiguous : std::integral_constant<bool, std::contiguous_iterator<Iterator>> {};
+#    else
+template<class Iterator, bool = std::is_class<Iterator>::value && IsRandomAccess<Iterator>::value>
+struct IsContiguous : std::is_pointer<Iterator> {};
+
+// Before C++20 there is no way to ask whether an iterator is contiguous, so only the iterators of the standard containers that
+// are known to be contiguous are recognized
+template<class Iterator>
+struct IsContiguous<Iterator, true>
+    : std::integral_constant<
+          bool, !std::is_same<ValueType<Iterator>, bool>::value &&
+                    (std::is_same<Iterator, typename std::vector<ValueType<Iterator>>::iterator>::value ||
+                     std::is_same<Iterator, typename std::vector<ValueType<Iterator>>::const_iterator>::value ||
+                     std::is_same<Iterator, std::string::iterator>::value ||
+                     std::is_same<Iterator, std::string::const_iterator>::value)> {};
+#    endif // LZ_HAS_CONCEPTS
+
 template<LZ_CONCEPT_INTEGRAL Arithmetic>
 inline constexpr bool isEven(const Arithmetic value) noexcept {
     return (value % 2) == 0;
 }
 
+// A fast pseudo random mix function, where every input maps to a unique output
+LZ_CONSTEXPR_CXX_14 std::uint64_t splitMix64(std::uint64_t x) noexcept {
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30u)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27u)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31u);
+}
+
+// The amount of steps of size `step` needed to cover `difference`, so `difference / step` rounded away from zero
+template<LZ_CONCEPT_INTEGRAL Arithmetic>
+inline constexpr std::ptrdiff_t divideAwayFromZero(const Arithmetic difference, const Arithmetic step) noexcept {
+    return static_cast<std::ptrdiff_t>(difference / step) +
+           (difference % step == 0 ? 0 : ((difference < 0) == (step < 0) ? 1 : -1));
+}
+
 template<LZ_CONCEPT_INTEGRAL Arithmetic>
 inline constexpr Arithmetic roundEven(const Arithmetic a, const Arithmetic b) noexcept {
     LZ_ASSERT(a != 0 && b != 0, "division by zero error");
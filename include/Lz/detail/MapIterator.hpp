@@ -6,8 +6,83 @@
 #include "FunctionContainer.hpp"
 #include "LzTools.hpp"
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 namespace lz {
 namespace internal {
+/**
+ * Wraps a pure function with a direct-mapped cache, used by `lz::memoMap`. Every input maps to a single slot, by its (mixed)
+ * hash. A lookup compares the input with the key in that slot, and only calls the function on a miss, after which the slot is
+ * overwritten. The slots are allocated once, so lookups never allocate. The slots are shared by all copies of the function, so
+ * that all iterators of a view use the same cache.
+ */
+template<class Function, class Key>
+class MemoizedFunction {
+    using Result = Decay<FunctionReturnType<Function, const Key&>>;
+
+    struct Slot {
+        Key key{};
+        Result result{};
+        bool isUsed{};
+    };
+
+    mutable FunctionContainer<Function> _function{};
+    std::shared_ptr<std::vector<Slot>> _slots{};
+    unsigned _shift{};
+
+    std::size_t slotOf(const Key& key) const {
+        // Fibonacci hashing spreads hashes that only differ in their low bits (such as the identity hash of integers) over
+        // all slots
+        const auto hash = static_cast<std::uint64_t>(std::hash<Key>()(key));
+        return static_cast<std::size_t>((hash * 0x9E3779B97F4A7C15ull) >> _shift);
+    }
+
+public:
+    MemoizedFunction(Function function, const std::size_t cacheSize) : _function(std::move(function)), _shift(64) {
+        std::size_t slotCount = 1;
+        while (slotCount < cacheSize) {
+            slotCount *= 2;
+            --_shift;
+        }
+        _slots = std::make_shared<std::vector<Slot>>(slotCount);
+    }
+
+    MemoizedFunction() = default;
+
+    Result operator()(const Key& key) const {
+        Slot& slot = (*_slots)[_shift == 64 ? 0 : slotOf(key)];
+        if (!slot.isUsed || !(slot.key == key)) {
+            slot.result = _function(key);
+            slot.key = key;
+            slot.isUsed = true;
+        }
+        return slot.result;
+    }
+};
+
+/**
+ * The composition `second(first(x))` of two functions, used to fuse a map of a map into a single map, so that the sequence is
+ * only iterated over by a single iterator.
+ */
+template<class First, class Second>
+class ComposedFunction {
+    FunctionContainer<First> _first{};
+    FunctionContainer<Second> _second{};
+
+public:
+    ComposedFunction(const FunctionContainer<First>& first, Second second) : _first(first), _second(std::move(second)) {
+    }
+
+    ComposedFunction() = default;
+
+    template<class T>
+    auto operator()(T&& value) const -> decltype(_second(_first(std::forward<T>(value)))) {
+        return _second(_first(std::forward<T>(value)));
+    }
+};
+
 template<LZ_CONCEPT_ITERATOR Iterator, class Function>
 class MapIterator {
     Iterator _iterator{};
@@ -29,6 +104,14 @@ public:
 
     constexpr MapIterator() = default;
 
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 const Iterator& base() const noexcept {
+        return _iterator;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 const FunctionContainer<Function>& function() const noexcept {
+        return _function;
+    }
+
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
         return _function(*_iterator);
     }
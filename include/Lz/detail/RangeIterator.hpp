@@ -4,6 +4,7 @@
 #    define LZ_RANGE_ITERATOR_HPP
 
 #    include <cmath>
+#    include <functional>
 #    include <iterator>
 
 namespace lz {
@@ -15,7 +16,7 @@ std::ptrdiff_t plusImpl(const ValueType difference, const ValueType step) noexce
         return static_cast<std::ptrdiff_t>(std::ceil(difference / step));
     }
     else {
-        return static_cast<std::ptrdiff_t>(roundEven(difference, step));
+        return divideAwayFromZero(difference, step);
     }
 }
 #    else
@@ -27,7 +28,7 @@ EnableIf<std::is_floating_point<ValueType>::value, std::ptrdiff_t> plusImpl(cons
 template<class ValueType>
 constexpr EnableIf<!std::is_floating_point<ValueType>::value, std::ptrdiff_t>
 plusImpl(const ValueType difference, const ValueType step) noexcept {
-    return static_cast<std::ptrdiff_t>(roundEven(difference, step));
+    return divideAwayFromZero(difference, step);
 }
 #    endif // __cpp_if_constexpr
 
@@ -43,6 +44,57 @@ public:
     using pointer = Arithmetic;
     using reference = Arithmetic;
 
+private:
+    template<class T, class A>
+    using IfIntegral = EnableIf<std::is_integral<A>::value, T>;
+
+    // The amount of elements in [begin, end). Unlike end - begin, this is also correct for ranges that are empty because they
+    // start past their end
+    LZ_NODISCARD static difference_type length(const RangeIterator& begin, const RangeIterator& end) {
+        return begin != end ? end - begin : 0;
+    }
+
+    // init + length * first + step * (0 + 1 + ... + (length - 1)). For integral results this is computed with unsigned
+    // arithmetic, which wraps instead of overflowing, so intermediate products that do not fit T still give the right sum
+    template<class T>
+    LZ_NODISCARD static T sumOf(const T init, const difference_type length, const Arithmetic first, const Arithmetic step,
+                                std::true_type /* isIntegral */) {
+        using Unsigned = unsigned long long;
+        const auto n = static_cast<Unsigned>(length);
+        // The even factor of n * (n - 1) is halved first, so that the division is exact
+        const Unsigned triangle = isEven(n) ? (n / 2) * (n - 1) : n * ((n - 1) / 2);
+        return static_cast<T>(static_cast<Unsigned>(init) + n * static_cast<Unsigned>(first) +
+                              triangle * static_cast<Unsigned>(step));
+    }
+
+    template<class T>
+    LZ_NODISCARD static T sumOf(const T init, const difference_type length, const Arithmetic first, const Arithmetic step,
+                                std::false_type /* isIntegral */) {
+        const difference_type triangle = isEven(length) ? (length / 2) * (length - 1) : length * ((length - 1) / 2);
+        return static_cast<T>(init + static_cast<T>(length) * static_cast<T>(first) +
+                              static_cast<T>(triangle) * static_cast<T>(step));
+    }
+
+    // The index of `value` in [begin, end), or the length of the sequence if it does not contain `value`
+    template<class T>
+    LZ_NODISCARD static difference_type indexOf(const RangeIterator& begin, const RangeIterator& end, const T& value) {
+        using Common = typename std::common_type<Arithmetic, T>::type;
+        const difference_type length = RangeIterator::length(begin, end);
+        const Common offset = static_cast<Common>(value) - static_cast<Common>(begin._iterator);
+        const Common step = static_cast<Common>(begin._step);
+        if (offset % step != 0) {
+            return length;
+        }
+        const auto index = static_cast<difference_type>(offset / step);
+        return index >= 0 && index < length ? index : length;
+    }
+
+    LZ_NODISCARD static RangeIterator last(const RangeIterator& begin, const RangeIterator& end) {
+        return begin + (length(begin, end) - 1);
+    }
+
+public:
+
     constexpr RangeIterator(const Arithmetic iterator, const Arithmetic step) noexcept : _iterator(iterator), _step(step) {
     }
 
@@ -135,6 +187,85 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const RangeIterator& a, const RangeIterator& b) noexcept {
         return !(a < b); // NOLINT
     }
+    // An integral range is an arithmetic progression, so the terminal operations below have a closed form and don't have to
+    // visit every element. Floating point ranges are iterated as usual, because adding the step n times does not round the
+    // same way as multiplying it by n.
+    template<class OutputIterator, class A = Arithmetic>
+    friend IfIntegral<OutputIterator, A>
+    copyImpl(const RangeIterator& begin, const RangeIterator& end, OutputIterator outputIterator) {
+        // The amount of elements is known up front, so this is a counted loop that can be vectorized. The step is copied, so
+        // that the compiler doesn't have to assume that writing to the output changes it
+        const difference_type length = RangeIterator::length(begin, end);
+        const Arithmetic step = begin._step;
+        Arithmetic value = begin._iterator;
+        for (difference_type i = 0; i < length; ++i, ++outputIterator, value += step) {
+            *outputIterator = value;
+        }
+        return outputIterator;
+    }
+
+    template<class UnaryFunc, class A = Arithmetic>
+    friend IfIntegral<UnaryFunc, A> forEachImpl(const RangeIterator& begin, const RangeIterator& end, UnaryFunc func) {
+        const difference_type length = RangeIterator::length(begin, end);
+        const Arithmetic step = begin._step;
+        Arithmetic value = begin._iterator;
+        for (difference_type i = 0; i < length; ++i, value += step) {
+            func(value);
+        }
+        return func;
+    }
+
+    // Only for std::plus<T> and std::plus<>, which add in the type of the result. Other types of std::plus convert every
+    // intermediate result, which the closed form cannot do
+    template<class T, class U, class A = Arithmetic>
+    LZ_NODISCARD friend EnableIf<std::is_integral<A>::value && std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+                                     (std::is_same<U, T>::value || std::is_void<U>::value),
+                                 T>
+    foldlImpl(const RangeIterator& begin, const RangeIterator& end, T init, std::plus<U>) {
+        return sumOf(init, RangeIterator::length(begin, end), begin._iterator, begin._step, std::is_integral<T>());
+    }
+
+    template<class T, class A = Arithmetic>
+    LZ_NODISCARD friend EnableIf<std::is_integral<A>::value && std::is_integral<T>::value &&
+                                     std::is_signed<T>::value == std::is_signed<A>::value,
+                                 difference_type>
+    countImpl(const RangeIterator& begin, const RangeIterator& end, const T& value) {
+        return indexOf(begin, end, value) == length(begin, end) ? 0 : 1;
+    }
+
+    template<class T, class A = Arithmetic>
+    LZ_NODISCARD friend EnableIf<std::is_integral<A>::value && std::is_integral<T>::value &&
+                                     std::is_signed<T>::value == std::is_signed<A>::value,
+                                 RangeIterator>
+    findImpl(const RangeIterator& begin, const RangeIterator& end, const T& value) {
+        const difference_type index = indexOf(begin, end, value);
+        return index == length(begin, end) ? end : begin + index;
+    }
+
+    // The sequence is sorted, ascending if the step is positive and descending otherwise
+    template<class U, class A = Arithmetic>
+    LZ_NODISCARD friend IfIntegral<RangeIterator, A>
+    minElementImpl(const RangeIterator& begin, const RangeIterator& end, std::less<U>) {
+        if (!(begin != end)) {
+            return end;
+        }
+        return begin._step < 0 ? last(begin, end) : begin;
+    }
+
+    template<class U, class A = Arithmetic>
+    LZ_NODISCARD friend IfIntegral<RangeIterator, A>
+    maxElementImpl(const RangeIterator& begin, const RangeIterator& end, std::less<U>) {
+        if (!(begin != end)) {
+            return end;
+        }
+        return begin._step < 0 ? begin : last(begin, end);
+    }
+
+    template<class U, class A = Arithmetic>
+    LZ_NODISCARD friend IfIntegral<double, A> medianImpl(const RangeIterator& begin, const RangeIterator& end, std::less<U>) {
+        const difference_type length = RangeIterator::length(begin, end);
+        return (static_cast<double>(begin[(length - 1) / 2]) + static_cast<double>(begin[length / 2])) / 2.;
+    }
 };
 } // namespace internal
 } // namespace lz
@@ -5,6 +5,7 @@
 
 #include "LzTools.hpp"
 
+#include <algorithm>
 #include <limits>
 
 namespace lz {
@@ -124,6 +125,28 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator>=(const RepeatIterator& a, const RepeatIterator& b) noexcept {
         return !(a < b); // NOLINT
     }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend UnaryFunc forEachImpl(const RepeatIterator& begin, const RepeatIterator& end, UnaryFunc func) {
+        for (std::size_t i = begin._iterator; i != end._iterator; ++i) {
+            func(begin._toRepeat);
+        }
+        return func;
+    }
+
+    // std::fill_n fills trivially copyable bytes using memset
+    template<class OutputIterator>
+    LZ_CONSTEXPR_CXX_20 friend OutputIterator
+    copyImpl(const RepeatIterator& begin, const RepeatIterator& end, OutputIterator outputIterator) {
+        return std::fill_n(std::move(outputIterator), end._iterator - begin._iterator, begin._toRepeat);
+    }
+
+    // Containers such as std::vector are filled at once, instead of inserting the value one by one
+    template<class Container>
+    LZ_CONSTEXPR_CXX_20 friend auto insertImpl(Container& container, const RepeatIterator& begin, const RepeatIterator& end)
+        -> decltype(void(container.insert(container.begin(), std::size_t{}, std::declval<const T&>()))) {
+        container.insert(container.begin(), end._iterator - begin._iterator, begin._toRepeat);
+    }
 };
 } // namespace internal
 } // namespace lz
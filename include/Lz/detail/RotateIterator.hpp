@@ -3,6 +3,7 @@
 #ifndef LZ_ROTATE_ITERATOR_HPP
 #    define LZ_ROTATE_ITERATOR_HPP
 
+#    include <algorithm>
 #    include <iterator>
 
 namespace lz {
@@ -29,6 +30,22 @@ private:
     difference_type _current{};
     difference_type _distance{};
 
+    // The elements in [first, last) are stored in at most two plain sequences: [first._iterator, firstEnd), which stops at the
+    // end of the underlying sequence, followed by [_begin, secondEnd)
+    struct Segments {
+        Iterator firstEnd;
+        Iterator secondEnd;
+    };
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 static Segments segments(const RotateIterator& first, const RotateIterator& last) {
+        const auto length = last - first;
+        const auto untilEnd = first._end - first._iterator;
+        if (length <= untilEnd) {
+            return { first._iterator + length, first._begin };
+        }
+        return { first._end, first._begin + (length - untilEnd) };
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20 RotateIterator(Iterator begin, Iterator end, Iterator iterator, const difference_type start,
                                        const difference_type current, const difference_type distance) :
@@ -130,6 +147,39 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const RotateIterator& a, const RotateIterator& b) {
         return !(a < b); // NOLINT
     }
+
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend UnaryFunc forEachImpl(const RotateIterator& begin, const RotateIterator& end, UnaryFunc func) {
+        const Segments parts = segments(begin, end);
+        for (auto it = begin._iterator; it != parts.firstEnd; ++it) {
+            func(*it);
+        }
+        for (auto it = begin._begin; it != parts.secondEnd; ++it) {
+            func(*it);
+        }
+        return func;
+    }
+
+    // std::copy is used for both parts, which copies trivially copyable contiguous data using memmove
+    template<class OutputIterator>
+    LZ_CONSTEXPR_CXX_20 friend OutputIterator
+    copyImpl(const RotateIterator& begin, const RotateIterator& end, OutputIterator outputIterator) {
+        const Segments parts = segments(begin, end);
+        outputIterator = std::copy(begin._iterator, parts.firstEnd, std::move(outputIterator));
+        return std::copy(begin._begin, parts.secondEnd, std::move(outputIterator));
+    }
+
+    template<class T, class BinaryOp>
+    LZ_CONSTEXPR_CXX_20 friend T foldlImpl(const RotateIterator& begin, const RotateIterator& end, T init, BinaryOp binaryOp) {
+        const Segments parts = segments(begin, end);
+        for (auto it = begin._iterator; it != parts.firstEnd; ++it) {
+            init = binaryOp(std::move(init), *it);
+        }
+        for (auto it = begin._begin; it != parts.secondEnd; ++it) {
+            init = binaryOp(std::move(init), *it);
+        }
+        return init;
+    }
 };
 
 template<class Iterator>
@@ -0,0 +1,101 @@
+#pragma once
+
+#ifndef LZ_SAMPLE_ITERATOR_HPP
+#define LZ_SAMPLE_ITERATOR_HPP
+
+#include "LzTools.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+namespace lz {
+namespace internal {
+template<class Iterator>
+EnableIf<IsRandomAccess<Iterator>::value>
+advanceAtMost(Iterator& iterator, const Iterator& end, const DiffType<Iterator> amount) {
+    using lz::next;
+    using std::next;
+    const auto left = getIterLength(iterator, end);
+    iterator = next(std::move(iterator), (std::min)(amount, left));
+}
+
+template<class Iterator>
+EnableIf<!IsRandomAccess<Iterator>::value> advanceAtMost(Iterator& iterator, const Iterator& end, DiffType<Iterator> amount) {
+    for (; amount > 0 && iterator != end; --amount) {
+        ++iterator;
+    }
+}
+
+template<LZ_CONCEPT_ITERATOR Iterator, class Generator>
+class SampleRateIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    // Every increment draws a new random skip, so a copy or a second pass yields a different subsequence
+    using iterator_category = std::input_iterator_tag;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+private:
+    using Distribution = std::geometric_distribution<difference_type>;
+
+    Iterator _iterator{};
+    Iterator _end{};
+    Distribution _distribution{};
+    Generator* _generator{ nullptr };
+    // A geometric distribution requires a probability in (0, 1), with a probability of 1 every element is selected
+    bool _isEveryElement{};
+
+    void skip() {
+        if (!_isEveryElement && _iterator != _end) {
+            advanceAtMost(_iterator, _end, _distribution(*_generator));
+        }
+    }
+
+public:
+    SampleRateIterator(Iterator iterator, Iterator end, const double probability, Generator& generator) :
+        _iterator(std::move(iterator)),
+        _end(std::move(end)),
+        _distribution(probability < 1 ? Distribution(probability) : Distribution()),
+        _generator(&generator),
+        _isEveryElement(probability >= 1) {
+        skip();
+    }
+
+    SampleRateIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return *_iterator;
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    SampleRateIterator& operator++() {
+        ++_iterator;
+        skip();
+        return *this;
+    }
+
+    SampleRateIterator operator++(int) {
+        SampleRateIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend bool operator!=(const SampleRateIterator& a, const SampleRateIterator& b) noexcept {
+        return a._iterator != b._iterator;
+    }
+
+    LZ_NODISCARD friend bool operator==(const SampleRateIterator& a, const SampleRateIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif
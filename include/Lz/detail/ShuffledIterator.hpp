@@ -0,0 +1,171 @@
+#pragma once
+
+#ifndef LZ_SHUFFLED_ITERATOR_HPP
+#define LZ_SHUFFLED_ITERATOR_HPP
+
+#include "LzTools.hpp"
+
+#include <cstdint>
+
+namespace lz {
+namespace internal {
+/**
+ * A pseudo random bijection of [0, size). A balanced Feistel network permutes [0, 2^(2 * halfBits)), where 2^(2 * halfBits) is
+ * the smallest even power of two >= size, and values that fall outside of [0, size) are fed through the network again
+ * (cycle walking). Because the domain is less than 4 * size, this takes less than 4 round trips on average.
+ */
+class FeistelPermutation {
+    static constexpr std::size_t Rounds = 4;
+
+    std::uint64_t _keys[Rounds]{};
+    std::uint64_t _size{};
+    std::uint64_t _mask{};
+    unsigned _halfBits{};
+
+    LZ_CONSTEXPR_CXX_14 std::uint64_t encrypt(const std::uint64_t value) const noexcept {
+        std::uint64_t left = value >> _halfBits;
+        std::uint64_t right = value & _mask;
+        for (std::size_t i = 0; i < Rounds; ++i) {
+            const std::uint64_t next = left ^ (splitMix64(right ^ _keys[i]) & _mask);
+            left = right;
+            right = next;
+        }
+        return (left << _halfBits) | right;
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_14 FeistelPermutation(const std::uint64_t size, std::uint64_t seed) noexcept : _size(size), _halfBits(1) {
+        while ((std::uint64_t(1) << (2 * _halfBits)) < size) {
+            ++_halfBits;
+        }
+        _mask = (std::uint64_t(1) << _halfBits) - 1;
+        for (std::size_t i = 0; i < Rounds; ++i) {
+            seed = splitMix64(seed);
+            _keys[i] = seed;
+        }
+    }
+
+    constexpr FeistelPermutation() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 std::uint64_t operator()(std::uint64_t index) const noexcept {
+        do {
+            index = encrypt(index);
+        } while (index >= _size);
+        return index;
+    }
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator>
+class ShuffledIterator {
+    using IterTraits = std::iterator_traits<Iterator>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename IterTraits::value_type;
+    using difference_type = typename IterTraits::difference_type;
+    using reference = typename IterTraits::reference;
+    using pointer = FakePointerProxy<reference>;
+
+private:
+    Iterator _begin{};
+    FeistelPermutation _permutation{};
+    difference_type _index{};
+
+public:
+    LZ_CONSTEXPR_CXX_14 ShuffledIterator(Iterator begin, const FeistelPermutation& permutation, const difference_type index) :
+        _begin(std::move(begin)),
+        _permutation(permutation),
+        _index(index) {
+    }
+
+    constexpr ShuffledIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 reference operator*() const {
+        return _begin[static_cast<difference_type>(_permutation(static_cast<std::uint64_t>(_index)))];
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_17 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_14 ShuffledIterator& operator++() noexcept {
+        ++_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 ShuffledIterator operator++(int) noexcept {
+        ShuffledIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_14 ShuffledIterator& operator--() noexcept {
+        --_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_14 ShuffledIterator operator--(int) noexcept {
+        ShuffledIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_14 ShuffledIterator& operator+=(const difference_type offset) noexcept {
+        _index += offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 ShuffledIterator operator+(const difference_type offset) const noexcept {
+        ShuffledIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_14 ShuffledIterator& operator-=(const difference_type offset) noexcept {
+        _index -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 ShuffledIterator operator-(const difference_type offset) const noexcept {
+        ShuffledIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend difference_type
+    operator-(const ShuffledIterator& a, const ShuffledIterator& b) noexcept {
+        return a._index - b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator!=(const ShuffledIterator& a, const ShuffledIterator& b) noexcept {
+        return a._index != b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator==(const ShuffledIterator& a, const ShuffledIterator& b) noexcept {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator<(const ShuffledIterator& a, const ShuffledIterator& b) noexcept {
+        return a._index < b._index;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator>(const ShuffledIterator& a, const ShuffledIterator& b) noexcept {
+        return b < a;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator<=(const ShuffledIterator& a, const ShuffledIterator& b) noexcept {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_14 friend bool operator>=(const ShuffledIterator& a, const ShuffledIterator& b) noexcept {
+        return !(a < b); // NOLINT
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif
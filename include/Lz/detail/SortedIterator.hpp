@@ -0,0 +1,251 @@
+#pragma once
+
+#ifndef LZ_SORTED_ITERATOR_HPP
+#define LZ_SORTED_ITERATOR_HPP
+
+#include "LzTools.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace lz {
+namespace internal {
+/**
+ * The shared state of a `lz::Sorted` view. The sequence is copied into a buffer the first time it is needed, after which the
+ * buffer is sorted incrementally (incremental quicksort): the unsorted part of the buffer is split into segments by a stack of
+ * pivot positions, of which every segment only contains elements that are larger than the ones of the segments before it. To get
+ * the next element, only the first segment is partitioned further, using nth_element at its middle, until it is small enough
+ * to be sorted. Getting the first m elements therefore takes O(n + m log(n)) instead of O(n log(n)).
+ */
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare>
+class IncrementalSort {
+    using Buffer = std::vector<ValueType<Iterator>>;
+    using BufferIterator = typename Buffer::iterator;
+
+    static constexpr std::size_t SortThreshold = 16;
+
+    Iterator _begin{};
+    Iterator _end{};
+    Compare _compare{};
+    Buffer _buffer{};
+    // The ends of the unsorted segments, the last one is the end of the first segment
+    std::vector<std::size_t> _segmentEnds{};
+    // All elements before this position are in their sorted position
+    std::size_t _sortedEnd{};
+    bool _isCopied{};
+
+    BufferIterator at(const std::size_t index) {
+        return _buffer.begin() + static_cast<DiffType<BufferIterator>>(index);
+    }
+
+    void copyBuffer(std::true_type /* isRandomAccess */) {
+        _buffer.assign(_begin, _end);
+    }
+
+    // Copies in a single pass, instead of getting the length first
+    void copyBuffer(std::false_type /* isRandomAccess */) {
+        std::copy(_begin, _end, std::back_inserter(_buffer));
+    }
+
+    void copy() {
+        copyBuffer(IsRandomAccess<Iterator>());
+        _segmentEnds.push_back(_buffer.size());
+        _isCopied = true;
+    }
+
+public:
+    IncrementalSort(Iterator begin, Iterator end, Compare compare) :
+        _begin(std::move(begin)),
+        _end(std::move(end)),
+        _compare(std::move(compare)) {
+    }
+
+    std::size_t size() {
+        if (!_isCopied) {
+            copy();
+        }
+        return _buffer.size();
+    }
+
+    // Puts every element up to and including the one at `index` in its sorted position. If a segment is needed as a whole, it is
+    // sorted at once
+    void sortUntil(const std::size_t index) {
+        if (!_isCopied) {
+            copy();
+        }
+        while (index >= _sortedEnd) {
+            const std::size_t segmentEnd = _segmentEnds.back();
+            if (segmentEnd - _sortedEnd <= SortThreshold || segmentEnd - 1 <= index) {
+                std::sort(at(_sortedEnd), at(segmentEnd), _compare);
+                _sortedEnd = segmentEnd;
+                _segmentEnds.pop_back();
+                continue;
+            }
+            const std::size_t middle = _sortedEnd + (segmentEnd - _sortedEnd) / 2;
+            std::nth_element(at(_sortedEnd), at(middle), at(segmentEnd), _compare);
+            _segmentEnds.push_back(middle);
+        }
+    }
+
+    const ValueType<Iterator>& operator[](const std::size_t index) {
+        sortUntil(index);
+        return _buffer[index];
+    }
+
+    const ValueType<Iterator>* data() const {
+        return _buffer.data();
+    }
+};
+
+template<LZ_CONCEPT_ITERATOR Iterator, class Compare>
+class SortedIterator {
+    using State = IncrementalSort<Iterator, Compare>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = ValueType<Iterator>;
+    using difference_type = DiffType<Iterator>;
+    using reference = const value_type&;
+    using pointer = const value_type*;
+
+private:
+    static constexpr std::size_t End = (std::numeric_limits<std::size_t>::max)();
+
+    // Shared by all copies of the iterator, so that iterators stay valid after the view is destroyed, for e.g. in `IterView`
+    // chains
+    std::shared_ptr<State> _state{};
+    // The position in the sorted sequence, or End for the end iterator, of which the position is only known after the sequence
+    // has been copied
+    std::size_t _index{};
+
+    LZ_NODISCARD std::size_t index() const {
+        return _index == End ? _state->size() : _index;
+    }
+
+    // Sorts the elements in [begin, end) and returns a pointer to the first one
+    static pointer sortRange(const SortedIterator& begin, const SortedIterator& end) {
+        const std::size_t first = begin.index();
+        const std::size_t last = end.index();
+        if (first != last) {
+            begin._state->sortUntil(last - 1);
+        }
+        return begin._state->data() + first;
+    }
+
+public:
+    SortedIterator(std::shared_ptr<State> state, const std::size_t index) : _state(std::move(state)), _index(index) {
+    }
+
+    static SortedIterator end(std::shared_ptr<State> state) {
+        return SortedIterator(std::move(state), End);
+    }
+
+    SortedIterator() = default;
+
+    LZ_NODISCARD reference operator*() const {
+        return (*_state)[index()];
+    }
+
+    LZ_NODISCARD pointer operator->() const {
+        return std::addressof(**this);
+    }
+
+    SortedIterator& operator++() {
+        _index = index() + 1;
+        return *this;
+    }
+
+    SortedIterator operator++(int) {
+        SortedIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    SortedIterator& operator--() {
+        _index = index() - 1;
+        return *this;
+    }
+
+    SortedIterator operator--(int) {
+        SortedIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    SortedIterator& operator+=(const difference_type offset) {
+        _index = static_cast<std::size_t>(static_cast<difference_type>(index()) + offset);
+        return *this;
+    }
+
+    LZ_NODISCARD SortedIterator operator+(const difference_type offset) const {
+        SortedIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    SortedIterator& operator-=(const difference_type offset) {
+        return *this += -offset;
+    }
+
+    LZ_NODISCARD SortedIterator operator-(const difference_type offset) const {
+        SortedIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    LZ_NODISCARD friend difference_type operator-(const SortedIterator& a, const SortedIterator& b) {
+        return static_cast<difference_type>(a.index()) - static_cast<difference_type>(b.index());
+    }
+
+    LZ_NODISCARD reference operator[](const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    LZ_NODISCARD friend bool operator!=(const SortedIterator& a, const SortedIterator& b) {
+        return a._index != b._index && a.index() != b.index();
+    }
+
+    LZ_NODISCARD friend bool operator==(const SortedIterator& a, const SortedIterator& b) {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator<(const SortedIterator& a, const SortedIterator& b) {
+        return b - a > 0;
+    }
+
+    LZ_NODISCARD friend bool operator>(const SortedIterator& a, const SortedIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD friend bool operator<=(const SortedIterator& a, const SortedIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD friend bool operator>=(const SortedIterator& a, const SortedIterator& b) {
+        return !(a < b); // NOLINT
+    }
+
+    // The elements of a whole range are sorted at once, instead of one by one
+    template<class UnaryFunc>
+    friend UnaryFunc forEachImpl(const SortedIterator& begin, const SortedIterator& end, UnaryFunc func) {
+        const pointer first = sortRange(begin, end);
+        const pointer last = first + (end - begin);
+        for (pointer it = first; it != last; ++it) {
+            func(*it);
+        }
+        return func;
+    }
+
+    template<class OutputIterator>
+    friend OutputIterator copyImpl(const SortedIterator& begin, const SortedIterator& end, OutputIterator output) {
+        const pointer first = sortRange(begin, end);
+        return std::copy(first, first + (end - begin), std::move(output));
+    }
+};
+} // namespace internal
+} // namespace lz
+
+#endif // LZ_SORTED_ITERATOR_HPP
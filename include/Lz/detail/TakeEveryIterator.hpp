@@ -153,6 +153,48 @@ public:
     }
 #    endif
 
+    // The amount of elements in [begin, end), for random access iterators
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 static difference_type
+    length(const TakeEveryIterator& begin, const TakeEveryIterator& end) {
+        const auto difference = end - begin;
+        return difference > 0 ? difference : 0;
+    }
+
+    template<difference_type Stride, class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 static void
+    stridedForEach(const Iterator first, const difference_type count, std::integral_constant<difference_type, Stride>,
+                   UnaryFunc& func) {
+        for (difference_type i = 0; i < count; ++i) {
+            func(first[i * Stride]);
+        }
+    }
+
+    // Calls func with every `stride`th element starting at first. Small strides (for e.g. de-interleaving 2, 3 or 4 channels)
+    // get a loop with a constant stride, which the compiler can unroll and vectorize
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 static void
+    stridedForEach(const Iterator first, const difference_type count, const difference_type stride, UnaryFunc& func) {
+        switch (stride) {
+        case 1:
+            stridedForEach(first, count, std::integral_constant<difference_type, 1>(), func);
+            break;
+        case 2:
+            stridedForEach(first, count, std::integral_constant<difference_type, 2>(), func);
+            break;
+        case 3:
+            stridedForEach(first, count, std::integral_constant<difference_type, 3>(), func);
+            break;
+        case 4:
+            stridedForEach(first, count, std::integral_constant<difference_type, 4>(), func);
+            break;
+        default:
+            for (difference_type i = 0; i < count; ++i) {
+                func(first[i * stride]);
+            }
+            break;
+        }
+    }
+
 public:
     LZ_CONSTEXPR_CXX_20
     TakeEveryIterator(Iterator iterator, Iterator begin, Iterator end, const difference_type offset) :
@@ -239,7 +281,7 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend difference_type
     operator-(const TakeEveryIterator& a, const TakeEveryIterator& b) {
         LZ_ASSERT(a._offset == b._offset, "incompatible iterator types: different offsets");
-        return roundEven(a._iterator - b._iterator, a._offset);
+        return static_cast<difference_type>(divideAwayFromZero(a._iterator - b._iterator, a._offset));
     }
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
@@ -271,6 +313,24 @@ public:
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const TakeEveryIterator& a, const TakeEveryIterator& b) {
         return !(a < b); // NOLINT
     }
+
+    template<class UnaryFunc, class I = Iterator>
+    LZ_CONSTEXPR_CXX_20 friend EnableIf<IsRandomAccess<I>::value, UnaryFunc>
+    forEachImpl(const TakeEveryIterator& begin, const TakeEveryIterator& end, UnaryFunc func) {
+        stridedForEach(begin._iterator, length(begin, end), begin._offset, func);
+        return func;
+    }
+
+    template<class OutputIterator, class I = Iterator>
+    LZ_CONSTEXPR_CXX_20 friend EnableIf<IsRandomAccess<I>::value, OutputIterator>
+    copyImpl(const TakeEveryIterator& begin, const TakeEveryIterator& end, OutputIterator outputIterator) {
+        auto copyOne = [&outputIterator](reference value) {
+            *outputIterator = value;
+            ++outputIterator;
+        };
+        stridedForEach(begin._iterator, length(begin, end), begin._offset, copyOne);
+        return outputIterator;
+    }
 };
 } // namespace internal
 } // namespace lz
@@ -10,7 +10,7 @@
 namespace lz {
 namespace internal {
 template<LZ_CONCEPT_ITERATOR... Iterators>
-class ZipIterator {
+class TupleZipIterator {
 public:
     using iterator_category = typename std::common_type<IterCat<Iterators>...>::type;
     using value_type = std::tuple<ValueType<Iterators>...>;
@@ -51,10 +51,10 @@ private:
     }
 
 public:
-    LZ_CONSTEXPR_CXX_20 explicit ZipIterator(std::tuple<Iterators...> iterators) : _iterators(std::move(iterators)) {
+    LZ_CONSTEXPR_CXX_20 explicit TupleZipIterator(std::tuple<Iterators...> iterators) : _iterators(std::move(iterators)) {
     }
 
-    constexpr ZipIterator() = default;
+    constexpr TupleZipIterator() = default;
 
     LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
         return dereference(MakeIndexSequenceForThis());
@@ -64,51 +64,51 @@ public:
         return FakePointerProxy<decltype(**this)>(**this);
     }
 
-    LZ_CONSTEXPR_CXX_20 ZipIterator& operator++() {
+    LZ_CONSTEXPR_CXX_20 TupleZipIterator& operator++() {
         increment(MakeIndexSequenceForThis());
         return *this;
     }
 
-    LZ_CONSTEXPR_CXX_20 ZipIterator operator++(int) {
-        ZipIterator tmp(*this);
+    LZ_CONSTEXPR_CXX_20 TupleZipIterator operator++(int) {
+        TupleZipIterator tmp(*this);
         ++*this;
         return tmp;
     }
 
-    LZ_CONSTEXPR_CXX_20 ZipIterator& operator--() {
+    LZ_CONSTEXPR_CXX_20 TupleZipIterator& operator--() {
         decrement(MakeIndexSequenceForThis());
         return *this;
     }
 
-    LZ_CONSTEXPR_CXX_20 ZipIterator operator--(int) {
+    LZ_CONSTEXPR_CXX_20 TupleZipIterator operator--(int) {
         auto tmp(*this);
         --*this;
         return tmp;
     }
 
-    LZ_CONSTEXPR_CXX_20 ZipIterator& operator+=(const difference_type offset) {
+    LZ_CONSTEXPR_CXX_20 TupleZipIterator& operator+=(const difference_type offset) {
         plusIs(MakeIndexSequenceForThis(), offset);
         return *this;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ZipIterator operator+(const difference_type offset) const {
-        ZipIterator tmp(*this);
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 TupleZipIterator operator+(const difference_type offset) const {
+        TupleZipIterator tmp(*this);
         tmp += offset;
         return tmp;
     }
 
-    LZ_CONSTEXPR_CXX_20 ZipIterator& operator-=(const difference_type offset) {
+    LZ_CONSTEXPR_CXX_20 TupleZipIterator& operator-=(const difference_type offset) {
         minIs(MakeIndexSequenceForThis(), offset);
         return *this;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 ZipIterator operator-(const difference_type offset) const {
-        ZipIterator tmp(*this);
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 TupleZipIterator operator-(const difference_type offset) const {
+        TupleZipIterator tmp(*this);
         tmp -= offset;
         return tmp;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const ZipIterator& other) const {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const TupleZipIterator& other) const {
         return std::get<0>(_iterators) - std::get<0>(other._iterators);
     }
 
@@ -116,30 +116,190 @@ public:
         return *(*this + offset);
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const ZipIterator& a, const ZipIterator& b) noexcept {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const TupleZipIterator& a, const TupleZipIterator& b) noexcept {
         return !(a != b); // NOLINT
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const ZipIterator& a, const ZipIterator& b) noexcept {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const TupleZipIterator& a, const TupleZipIterator& b) noexcept {
         return std::get<0>(a._iterators) != std::get<0>(b._iterators);
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const ZipIterator& a, const ZipIterator& b) {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const TupleZipIterator& a, const TupleZipIterator& b) {
         return std::get<0>(a._iterators) < std::get<0>(b._iterators);
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const ZipIterator& a, const ZipIterator& b) {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const TupleZipIterator& a, const TupleZipIterator& b) {
         return b < a;
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const ZipIterator& a, const ZipIterator& b) {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const TupleZipIterator& a, const TupleZipIterator& b) {
         return !(b < a); // NOLINT
     }
 
-    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const ZipIterator& a, const ZipIterator& b) {
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const TupleZipIterator& a, const TupleZipIterator& b) {
         return !(a < b); // NOLINT
     }
 };
+/**
+ * Zips iterators that all point to contiguous memory. Instead of advancing every iterator, it keeps the iterators it was created
+ * with and one index into all of them, so that ++ and the end check only touch a single counter. This allows the compiler to
+ * vectorize loops over the zipped sequences.
+ */
+template<LZ_CONCEPT_ITERATOR... Iterators>
+class IndexedZipIterator {
+public:
+    using iterator_category = typename std::common_type<IterCat<Iterators>...>::type;
+    using value_type = std::tuple<ValueType<Iterators>...>;
+    using difference_type = typename std::common_type<DiffType<Iterators>...>::type;
+    using reference = std::tuple<RefType<Iterators>...>;
+    using pointer = std::tuple<PointerType<Iterators>...>;
+
+private:
+    using MakeIndexSequenceForThis = MakeIndexSequence<sizeof...(Iterators)>;
+    std::tuple<Iterators...> _iterators{};
+    difference_type _index{};
+
+    template<std::size_t... I>
+    LZ_CONSTEXPR_CXX_20 reference dereference(IndexSequence<I...>, const difference_type index) const {
+        return { std::get<I>(_iterators)[index]... };
+    }
+
+    LZ_CONSTEXPR_CXX_20 reference at(const difference_type index) const {
+        return dereference(MakeIndexSequenceForThis(), index);
+    }
+
+public:
+    LZ_CONSTEXPR_CXX_20 explicit IndexedZipIterator(std::tuple<Iterators...> iterators) : _iterators(std::move(iterators)) {
+    }
+
+    constexpr IndexedZipIterator() = default;
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator*() const {
+        return at(_index);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 pointer operator->() const {
+        return FakePointerProxy<decltype(**this)>(**this);
+    }
+
+    LZ_CONSTEXPR_CXX_20 IndexedZipIterator& operator++() noexcept {
+        ++_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 IndexedZipIterator operator++(int) noexcept {
+        IndexedZipIterator tmp(*this);
+        ++*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 IndexedZipIterator& operator--() noexcept {
+        --_index;
+        return *this;
+    }
+
+    LZ_CONSTEXPR_CXX_20 IndexedZipIterator operator--(int) noexcept {
+        IndexedZipIterator tmp(*this);
+        --*this;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 IndexedZipIterator& operator+=(const difference_type offset) noexcept {
+        _index += offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IndexedZipIterator operator+(const difference_type offset) const noexcept {
+        IndexedZipIterator tmp(*this);
+        tmp += offset;
+        return tmp;
+    }
+
+    LZ_CONSTEXPR_CXX_20 IndexedZipIterator& operator-=(const difference_type offset) noexcept {
+        _index -= offset;
+        return *this;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 IndexedZipIterator operator-(const difference_type offset) const noexcept {
+        IndexedZipIterator tmp(*this);
+        tmp -= offset;
+        return tmp;
+    }
+
+    // The iterators of `this` and `other` may have been created at different positions (for e.g. begin and end), so the distance
+    // between the first iterators is taken into account as well
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 difference_type operator-(const IndexedZipIterator& other) const {
+        return static_cast<difference_type>(std::get<0>(_iterators) - std::get<0>(other._iterators)) + (_index - other._index);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 reference operator[](const difference_type offset) const {
+        return at(_index + offset);
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator==(const IndexedZipIterator& a, const IndexedZipIterator& b) {
+        return !(a != b); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator!=(const IndexedZipIterator& a, const IndexedZipIterator& b) {
+        return a - b != 0;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<(const IndexedZipIterator& a, const IndexedZipIterator& b) {
+        return a - b < 0;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>(const IndexedZipIterator& a, const IndexedZipIterator& b) {
+        return b < a;
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator<=(const IndexedZipIterator& a, const IndexedZipIterator& b) {
+        return !(b < a); // NOLINT
+    }
+
+    LZ_NODISCARD LZ_CONSTEXPR_CXX_20 friend bool operator>=(const IndexedZipIterator& a, const IndexedZipIterator& b) {
+        return !(a < b); // NOLINT
+    }
+
+    // The batch versions of the terminal operations. The amount of elements is known up front, so these are a counted loop over
+    // one index, which the compiler can unroll and vectorize
+    template<class UnaryFunc>
+    LZ_CONSTEXPR_CXX_20 friend UnaryFunc
+    forEachImpl(const IndexedZipIterator& begin, const IndexedZipIterator& end, UnaryFunc func) {
+        const difference_type last = begin._index + (end - begin);
+        for (difference_type index = begin._index; index < last; ++index) {
+            func(begin.at(index));
+        }
+        return func;
+    }
+
+    template<class OutputIterator>
+    LZ_CONSTEXPR_CXX_20 friend OutputIterator
+    copyImpl(const IndexedZipIterator& begin, const IndexedZipIterator& end, OutputIterator outputIterator) {
+        const difference_type last = begin._index + (end - begin);
+        for (difference_type index = begin._index; index < last; ++index, ++outputIterator) {
+            *outputIterator = begin.at(index);
+        }
+        return outputIterator;
+    }
+
+    template<class T, class BinaryOp>
+    LZ_CONSTEXPR_CXX_20 friend T
+    foldlImpl(const IndexedZipIterator& begin, const IndexedZipIterator& end, T init, BinaryOp binaryOp) {
+        const difference_type last = begin._index + (end - begin);
+        for (difference_type index = begin._index; index < last; ++index) {
+            init = binaryOp(std::move(init), begin.at(index));
+        }
+        return init;
+    }
+};
+
+/**
+ * The iterator of `lz::zip`. If all iterators are contiguous, a single index is used for all of them, otherwise every iterator is
+ * advanced on its own.
+ */
+template<LZ_CONCEPT_ITERATOR... Iterators>
+using ZipIterator = Conditional<IsAllSame<std::true_type, typename IsContiguous<Iterators>::type...>::value,
+                                IndexedZipIterator<Iterators...>, TupleZipIterator<Iterators...>>;
 } // namespace internal
 } // namespace lz
 
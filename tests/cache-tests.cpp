@@ -0,0 +1,47 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+
+TEST_CASE("Cache basic functionality", "[Cache][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    int calls = 0;
+    auto squares = lz::toIter(vec)
+                       .map([&calls](const int i) {
+                           ++calls;
+                           return i * i;
+                       })
+                       .cache();
+
+    SECTION("Should evaluate every element once") {
+        CHECK(squares.sum() == 55);
+        CHECK(squares.max() == 25);
+        CHECK(squares.toString(" ") == "1 4 9 16 25");
+        CHECK(squares.toVector() == std::vector<int>{ 1, 4, 9, 16, 25 });
+        CHECK(calls == 5);
+    }
+
+    SECTION("Should only evaluate what is used") {
+        auto it = squares.begin();
+        CHECK(*it == 1);
+        CHECK(*++it == 4);
+        CHECK(calls == 2);
+        CHECK(lz::take(squares, 3).toVector() == std::vector<int>{ 1, 4, 9 });
+        CHECK(calls == 3);
+        CHECK(squares.distance() == 5);
+        CHECK(calls == 5);
+    }
+
+    SECTION("Copies should share the buffer") {
+        auto copy = squares;
+        CHECK(copy.toVector() == std::vector<int>{ 1, 4, 9, 16, 25 });
+        CHECK(squares.toVector() == std::vector<int>{ 1, 4, 9, 16, 25 });
+        CHECK(calls == 5);
+    }
+
+    SECTION("Empty") {
+        std::list<int> list;
+        auto cached = lz::cache(list);
+        CHECK(cached.begin() == cached.end());
+        CHECK(cached.toVector().empty());
+    }
+}
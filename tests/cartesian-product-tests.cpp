@@ -106,6 +106,46 @@ TEST_CASE("Cartesian product binary operations", "[CartesianProduct][Binary ops]
     }
 }
 
+TEST_CASE("Cartesian product random access", "[CartesianProduct][Binary ops]") {
+    std::vector<int> vec = { 1, 2, 3 };
+    std::vector<char> chars = { 'a', 'b' };
+    std::array<double, 4> doubles = { 0.5, 1.5, 2.5, 3.5 };
+    auto cartesian = lz::cartesian(vec, chars, doubles);
+    auto begin = cartesian.begin();
+
+    SECTION("Operator-(Iterator)") {
+        CHECK(cartesian.end() - begin == 24);
+        CHECK(cartesian.size() == 24);
+        CHECK((begin + 17) - (begin + 5) == 12);
+        CHECK((begin + 5) - (begin + 17) == -12);
+    }
+
+    SECTION("Operator[]() and Operator+(int) should decode the index") {
+        CHECK(begin[0] == std::make_tuple(1, 'a', 0.5));
+        CHECK(begin[5] == std::make_tuple(1, 'b', 1.5));
+        CHECK(begin[13] == std::make_tuple(2, 'b', 1.5));
+        CHECK(begin[23] == std::make_tuple(3, 'b', 3.5));
+        CHECK(*(cartesian.end() - 9) == std::make_tuple(2, 'b', 3.5));
+        CHECK((begin + 10) + 14 == cartesian.end());
+    }
+
+    SECTION("Should be consistent with operator++") {
+        auto it = begin;
+        for (std::ptrdiff_t i = 0; i < 24; ++i, ++it) {
+            CHECK(*it == begin[i]);
+            CHECK(it == begin + i);
+        }
+        CHECK(it == cartesian.end());
+    }
+
+    SECTION("Empty sequence") {
+        std::vector<char> empty;
+        auto emptyCartesian = lz::cartesian(vec, empty, doubles);
+        CHECK(emptyCartesian.begin() == emptyCartesian.end());
+        CHECK(std::distance(emptyCartesian.begin(), emptyCartesian.end()) == 0);
+    }
+}
+
 TEST_CASE("CartesianProduct to containers", "[CartesianProduct][To container]") {
     std::vector<int> vec = { 1, 2, 3 };
     std::vector<char> chars = { 'a', 'b', 'c' };
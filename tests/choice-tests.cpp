@@ -0,0 +1,131 @@
+#include <Lz/Choice.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+#include <map>
+
+TEST_CASE("Choice basic functionality", "[Choice][Basic functionality]") {
+    std::array<char, 4> letters = { 'a', 'b', 'c', 'd' };
+    std::array<int, 4> weights = { 1, 0, 3, 4 };
+    std::mt19937 gen(1234);
+    constexpr std::size_t size = 8000;
+
+    auto choice = lz::choice(letters, weights, gen, size);
+
+    SECTION("Should be sized") {
+        CHECK(std::distance(choice.begin(), choice.end()) == static_cast<std::ptrdiff_t>(size));
+    }
+
+    SECTION("Should respect the weights") {
+        std::map<char, std::size_t> counts;
+        for (const char c : choice) {
+            ++counts[c];
+        }
+        CHECK(counts.find('b') == counts.end());
+        CHECK(counts['a'] + counts['c'] + counts['d'] == size);
+        // Expected: a = 1000, c = 3000, d = 4000
+        CHECK(counts['a'] > 800);
+        CHECK(counts['a'] < 1200);
+        CHECK(counts['c'] > 2700);
+        CHECK(counts['c'] < 3300);
+        CHECK(counts['d'] > 3700);
+        CHECK(counts['d'] < 4300);
+    }
+
+    SECTION("Should return references to the underlying sequence") {
+        const char& ref = choice.nextChoice();
+        CHECK((&ref >= letters.data() && &ref < letters.data() + letters.size()));
+        CHECK(choice.nextIndex() < letters.size());
+    }
+
+    SECTION("Single weight") {
+        std::array<int, 1> one = { 5 };
+        std::array<double, 1> oneWeight = { 0.1 };
+        CHECK(lz::choice(one, oneWeight, gen, 10).toVector() == std::vector<int>(10, 5));
+    }
+}
+
+TEST_CASE("Choice with default engine", "[Choice][Basic functionality]") {
+    std::vector<int> values = { 10, 20, 30 };
+    std::vector<double> weights = { 0., 1., 0. };
+    auto choice = lz::choice(values, weights, 50);
+    CHECK(choice.toVector() == std::vector<int>(50, 20));
+    CHECK(lz::choice(values, weights).nextChoice() == 20);
+}
+
+TEST_CASE("Choice binary operations", "[Choice][Binary ops]") {
+    constexpr std::ptrdiff_t size = 5;
+    std::array<int, 3> values = { 1, 2, 3 };
+    std::array<int, 3> weights = { 1, 1, 1 };
+    std::mt19937 gen(42);
+    auto choice = lz::choice(values, weights, gen, size);
+    auto it = choice.begin();
+
+    SECTION("Operator++") {
+        ++it;
+        CHECK(std::distance(it, choice.end()) == 4);
+    }
+
+    SECTION("Operator--") {
+        ++it;
+        --it;
+        CHECK(std::distance(it, choice.end()) == 5);
+    }
+
+    SECTION("Operator== & Operator!=") {
+        CHECK(it != choice.end());
+        it = choice.end();
+        CHECK(it == choice.end());
+    }
+
+    SECTION("Operator+(int), Operator-(int)") {
+        CHECK(std::distance(it + 2, choice.end()) == size - 2);
+        CHECK(std::distance((it + 2) - 1, choice.end()) == size - 1);
+    }
+
+    SECTION("Operator-(Iterator)") {
+        CHECK(choice.end() - it == size);
+    }
+
+    SECTION("Operator[]()") {
+        CHECK(it[3] >= 1);
+        CHECK(it[3] <= 3);
+    }
+
+    SECTION("Operator<, '<, <=, >, >='") {
+        CHECK(it < choice.end());
+        CHECK(it + size + 1 > choice.end());
+        CHECK(it + size <= choice.end());
+        CHECK(it + size >= choice.end());
+    }
+}
+
+TEST_CASE("Choice to containers", "[Choice][To container]") {
+    constexpr std::size_t size = 10;
+    std::array<int, 3> values = { 1, 2, 3 };
+    std::array<float, 3> weights = { 0.2f, 0.3f, 0.5f };
+    std::mt19937 gen(7);
+    auto choice = lz::choice(values, weights, gen, size);
+
+    SECTION("To array") {
+        CHECK(choice.toArray<size>().size() == size);
+    }
+
+    SECTION("To vector") {
+        CHECK(choice.toVector().size() == size);
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(choice.to<std::list>().size() == size);
+    }
+
+    SECTION("Bulk sampling") {
+        const std::vector<int> picks = choice.choices(1000);
+        CHECK(picks.size() == 1000);
+        CHECK(std::all_of(picks.begin(), picks.end(), [](int i) { return i >= 1 && i <= 3; }));
+
+        std::array<int, 20> buffer{};
+        auto last = choice.choicesTo(buffer.begin(), 20);
+        CHECK(last == buffer.end());
+        CHECK(std::find(buffer.begin(), buffer.end(), 0) == buffer.end());
+    }
+}
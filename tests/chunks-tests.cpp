@@ -2,7 +2,9 @@
 #include "catch2/catch.hpp"
 
 #include <Lz/FunctionTools.hpp>
+#include <forward_list>
 #include <list>
+#include <numeric>
 
 TEST_CASE("Chunks changing and creating elements", "[Chunks][Basic functionality]") {
     std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7 };
@@ -17,6 +19,13 @@ TEST_CASE("Chunks changing and creating elements", "[Chunks][Basic functionality
     SECTION("Should be correct length") {
         CHECK(std::distance(chunked.begin(), chunked.end()) == 3);
     }
+
+    SECTION("Forward iterators") {
+        std::forward_list<int> fwd = { 1, 2, 3, 4, 5, 6, 7 };
+        auto fwdChunked = lz::chunks(fwd, 3);
+        CHECK(std::distance(fwdChunked.begin(), fwdChunked.end()) == 3);
+        CHECK(std::next(fwdChunked.begin(), 2)->toVector() == std::vector<int>{ 7 });
+    }
 }
 
 TEST_CASE("Chunks binary operations", "[Chunks][Binary ops]") {
@@ -52,14 +61,15 @@ TEST_CASE("Chunks binary operations", "[Chunks][Binary ops]") {
     SECTION("Operator--") {
         auto end = chunked.end();
         --end;
-        CHECK(*end->begin() == 6);
+        CHECK(*end->begin() == 7);
         CHECK(end->end() == chunked.end()->end());
         --end;
-        CHECK(*end->begin() == 3);
-        CHECK(*end->end() == 6);
+        CHECK(*end->begin() == 4);
+        CHECK(*end->end() == 7);
         --end;
         CHECK(*end->begin() == 1);
-        CHECK(*end->end() == 3);
+        CHECK(*end->end() == 4);
+        CHECK(end == chunked.begin());
     }
 
     SECTION("Operator-- (bidirectional)") {
@@ -67,14 +77,15 @@ TEST_CASE("Chunks binary operations", "[Chunks][Binary ops]") {
         auto c = lz::chunks(lst, 3);
         auto iter = c.end();
         --iter;
-        CHECK(*iter->begin() == 6);
+        CHECK(*iter->begin() == 7);
         CHECK(iter->end() == c.end()->end());
         --iter;
-        CHECK(*iter->begin() == 3);
-        CHECK(*iter->end() == 6);
+        CHECK(*iter->begin() == 4);
+        CHECK(*iter->end() == 7);
         --iter;
         CHECK(*iter->begin() == 1);
-        CHECK(*iter->end() == 3);
+        CHECK(*iter->end() == 4);
+        CHECK(iter == c.begin());
     }
 
     SECTION("Operator== & operator!=") {
@@ -96,18 +107,20 @@ TEST_CASE("Chunks binary operations", "[Chunks][Binary ops]") {
         CHECK((beg + 2)->end() == chunked.end()->end());
         CHECK((beg + 3)->end() == chunked.end()->end());
 
-        CHECK(*(end + -1)->begin() == 6);
+        CHECK(*(end + -1)->begin() == 7);
         CHECK((end + -1)->end() == chunked.end()->end());
-        CHECK(*(end + -2)->begin() == 3);
-        CHECK(*(end + -2)->end() == 6);
+        CHECK(*(end + -2)->begin() == 4);
+        CHECK(*(end + -2)->end() == 7);
         CHECK(*(end + -3)->begin() == 1);
-        CHECK(*(end + -3)->end() == 3);
+        CHECK(*(end + -3)->end() == 4);
+        CHECK(beg + 10 == end);
     }
 
     SECTION("Operator-(int) offset, tests -= as well") {
         auto end = chunked.end();
-        CHECK(*(end - 1)->begin() == 6);
+        CHECK(*(end - 1)->begin() == 7);
         CHECK((end - 1)->end() == chunked.end()->end());
+        CHECK(end - 3 == chunked.begin());
     }
 
     SECTION("Operator-(Iterator)") {
@@ -140,6 +153,46 @@ TEST_CASE("Chunks binary operations", "[Chunks][Binary ops]") {
     }
 }
 
+TEST_CASE("Chunks random access splitting", "[Chunks][Basic functionality]") {
+    std::vector<int> v(10001);
+    std::iota(v.begin(), v.end(), 0);
+    auto chunked = lz::chunks(v, 100);
+
+    SECTION("Size") {
+        CHECK(chunked.size() == 101);
+        CHECK(lz::chunks(v, 10001).size() == 1);
+        CHECK(lz::chunks(v, 20000).size() == 1);
+        CHECK(lz::chunks(std::vector<int>(), 3).size() == 0);
+        CHECK(lz::chunks(std::vector<int>(9), 3).size() == 3);
+    }
+
+    SECTION("Same chunks from both sides") {
+        const auto size = static_cast<std::ptrdiff_t>(chunked.size());
+        for (std::ptrdiff_t i = 0; i < size; ++i) {
+            auto fromBegin = chunked.begin() + i;
+            auto fromEnd = chunked.end() - (size - i);
+            CHECK(fromBegin == fromEnd);
+            CHECK(fromBegin->begin() == fromEnd->begin());
+            CHECK(fromBegin->end() == fromEnd->end());
+            CHECK(fromBegin - chunked.begin() == i);
+        }
+    }
+
+    SECTION("Split into parts") {
+        const auto size = static_cast<std::ptrdiff_t>(chunked.size());
+        const std::ptrdiff_t parts = 4;
+        int sum = 0;
+        for (std::ptrdiff_t part = 0; part < parts; ++part) {
+            auto first = chunked.begin() + size * part / parts;
+            auto last = chunked.begin() + size * (part + 1) / parts;
+            for (; first != last; ++first) {
+                sum += std::accumulate(first->begin(), first->end(), 0);
+            }
+        }
+        CHECK(sum == std::accumulate(v.begin(), v.end(), 0));
+    }
+}
+
 TEST_CASE("Chunks to containers", "[Chunk][To container]") {
     std::vector<int> v = { 1, 2, 3, 4, 5, 6, 7, 8 };
     auto chunked = lz::chunks(v, 3);
@@ -93,6 +93,43 @@ TEST_CASE("Concat binary operations", "[Concat][Binary ops]") {
     }
 }
 
+TEST_CASE("Concat many sequences", "[Concat][Basic functionality]") {
+    std::vector<int> a = { 1, 2 }, b, c = { 3 }, d, e = { 4, 5, 6 }, f;
+    auto concat = lz::concat(a, b, c, d, e, f);
+    const std::vector<int> expected = { 1, 2, 3, 4, 5, 6 };
+
+    SECTION("Forward and backward") {
+        CHECK(concat.toVector() == expected);
+        CHECK(std::vector<int>(std::make_reverse_iterator(concat.end()), std::make_reverse_iterator(concat.begin())) ==
+              std::vector<int>{ 6, 5, 4, 3, 2, 1 });
+    }
+
+    SECTION("Random access") {
+        const auto begin = concat.begin();
+        const auto end = concat.end();
+        CHECK(end - begin == 6);
+        for (std::ptrdiff_t i = 0; i < 6; ++i) {
+            CHECK(begin[i] == expected[static_cast<std::size_t>(i)]);
+            CHECK(*(end - (6 - i)) == expected[static_cast<std::size_t>(i)]);
+            CHECK((begin + i) - begin == i);
+            CHECK(end - (begin + i) == 6 - i);
+            CHECK(std::next(begin, i) == begin + i);
+        }
+        CHECK(begin + 6 == end);
+        CHECK(end - 6 == begin);
+        CHECK(begin + 3 - 2 == begin + 1);
+    }
+
+    SECTION("Leading empty sequences and bidirectional iterators") {
+        std::list<int> empty, lst = { 1, 2 };
+        auto withEmpty = lz::concat(empty, lst, empty);
+        CHECK(*withEmpty.begin() == 1);
+        CHECK(std::distance(withEmpty.begin(), withEmpty.end()) == 2);
+        CHECK(*std::prev(withEmpty.end()) == 2);
+        CHECK(lz::concat(empty, empty).begin() == lz::concat(empty, empty).end());
+    }
+}
+
 TEST_CASE("Concatenate to containers", "[Concatenate][To container]") {
     std::vector<int> v1 = { 1, 2, 3 };
     std::vector<int> v2 = { 4, 5, 6 };
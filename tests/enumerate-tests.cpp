@@ -1,5 +1,7 @@
 #include <Lz/Enumerate.hpp>
+#include <Lz/Filter.hpp>
 #include <catch2/catch.hpp>
+#include <forward_list>
 #include <list>
 
 TEST_CASE("Enumerate changing and creating elements", "[Enumerate][Basic functionality]") {
@@ -22,6 +24,16 @@ TEST_CASE("Enumerate changing and creating elements", "[Enumerate][Basic functio
         CHECK(element.second == 1); // Element
     }
 
+    SECTION("Enumerate with the difference type as index type") {
+        auto enumerate = lz::enumerate<std::ptrdiff_t>(array, 5);
+        auto element = *enumerate.begin();
+
+        CHECK(element.first == 5);  // Idx
+        CHECK(element.second == 1); // Element
+        CHECK(enumerate.end() - enumerate.begin() == 2);
+        CHECK((*std::prev(enumerate.end())).first == 6);
+    }
+
     SECTION("Enumerate should be by reference") {
         auto enumerate = lz::enumerate(array);
         auto element = *enumerate.begin();
@@ -149,3 +161,38 @@ TEST_CASE("Enumerate to containers", "[Enumerate][To container]") {
         CHECK(actual == expected);
     }
 }
+
+TEST_CASE("Enumerate without calculating the length", "[Enumerate][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5, 6 };
+
+    SECTION("Filtered sequences are walked once") {
+        std::size_t calls = 0;
+        auto filtered = lz::filter(vec, [&calls](const int i) {
+            ++calls;
+            return i % 2 == 0;
+        });
+        auto enumerated = lz::enumerate(filtered, 1);
+        CHECK(calls == 2);
+
+        std::vector<std::pair<int, int>> actual;
+        for (const std::pair<int, int> pair : enumerated) {
+            actual.push_back(pair);
+        }
+        CHECK(actual == std::vector<std::pair<int, int>>{ { 1, 2 }, { 2, 4 }, { 3, 6 } });
+        CHECK(calls == vec.size());
+    }
+
+    SECTION("Forward sequences") {
+        std::forward_list<int> list = { 4, 5 };
+        auto enumerated = lz::enumerate(list);
+        CHECK(enumerated.toVector() == std::vector<std::pair<int, int>>{ { 0, 4 }, { 1, 5 } });
+        CHECK(enumerated.size() == 2);
+    }
+
+    SECTION("Random access sequences keep the index of the end") {
+        auto enumerated = lz::enumerateRange(vec.begin(), vec.end(), 10);
+        CHECK(enumerated.begin()->first == 10);
+        CHECK((--enumerated.end())->first == 15);
+        CHECK(enumerated.end() - enumerated.begin() == 6);
+    }
+}
@@ -1,4 +1,5 @@
 #include <Lz/Filter.hpp>
+#include <Lz/Map.hpp>
 #include <catch2/catch.hpp>
 #include <list>
 
@@ -31,6 +32,42 @@ TEST_CASE("Filter filters and is by reference", "[Filter][Basic functionality]")
         *it = 50;
         CHECK(array[0] == 50);
     }
+
+    SECTION("Should fuse a filter of a filter") {
+        auto filter = lz::filter(lz::filter(array, [](int element) { return element != 3; }),
+                                 [](int element) { return element != 1; });
+        static_assert(std::is_same<decltype(filter.begin().base()), const decltype(array.begin())&>::value,
+                      "Filter of a filter should be a single filter over the array");
+        auto it = filter.begin();
+        CHECK(*it == 2);
+        *it = 50;
+        CHECK(array[1] == 50);
+        CHECK(++it == filter.end());
+    }
+
+    SECTION("Should evaluate mapped elements once") {
+        int calls = 0;
+        auto map = lz::map(array, [&calls](int element) {
+            ++calls;
+            return element * 2;
+        });
+        auto filter = lz::filter(map, [](int element) { return element != 4; });
+        std::vector<int> result;
+        for (const int element : filter) {
+            result.push_back(element);
+        }
+        CHECK(result == std::vector<int>{ 2, 6 });
+        CHECK(calls == 3);
+    }
+
+    SECTION("Should not cache proxy references") {
+        std::vector<bool> bits{ true, false, true };
+        auto filter = lz::filter(bits, [](bool b) { return b; });
+        CHECK(std::count(filter.begin(), filter.end(), true) == 2);
+        CHECK(filter.toVector() == std::vector<bool>{ true, true });
+        *filter.begin() = false;
+        CHECK(bits == std::vector<bool>{ false, false, true });
+    }
 }
 
 TEST_CASE("Filter binary operations", "[Filter][Binary ops]") {
@@ -1,6 +1,7 @@
 #include "Lz/FunctionTools.hpp"
 
 #include <Lz/Flatten.hpp>
+#include <Lz/Lz.hpp>
 #include <catch2/catch.hpp>
 #include <list>
 
@@ -75,6 +76,24 @@ TEST_CASE("Flatten binary operations", "[Flatten][Binary ops]") {
     SECTION("Operator-(Iterator)") {
         //CHECK(flattened.end() - flattened.begin() == 7);
     }
+
+    SECTION("Size") {
+        using View = lz::internal::BasicIteratorView<decltype(flattened.begin())>;
+        const auto begin = flattened.begin();
+        CHECK(flattened.size() == 7);
+        CHECK(View(std::next(begin, 2), flattened.end()).size() == 5);
+        CHECK(View(std::next(begin, 2), std::next(begin, 3)).size() == 1);
+        CHECK(View(std::next(begin, 3), std::next(begin, 6)).size() == 3);
+        CHECK(View(begin, begin).size() == 0);
+        CHECK(View(flattened.end(), flattened.end()).size() == 0);
+
+        std::vector<std::vector<std::vector<int>>> vectors = { { { 1, 2, 3 }, {} }, { {}, { 4, 5 }, { 6 } }, {}, { { 7 }, {} } };
+        auto flattened3D = lz::flatten(vectors);
+        using View3D = lz::internal::BasicIteratorView<decltype(flattened3D.begin())>;
+        CHECK(flattened3D.size() == 7);
+        CHECK(View3D(std::next(flattened3D.begin(), 1), std::next(flattened3D.begin(), 5)).size() == 4);
+        CHECK(lz::flatten(std::vector<std::vector<int>>{ {}, {} }).size() == 0);
+    }
 }
 
 TEST_CASE("Flatten to container", "[Flatten][To container]") {
@@ -89,6 +108,21 @@ TEST_CASE("Flatten to container", "[Flatten][To container]") {
         CHECK(flattened.toVector() == std::vector<int>{ 1, 2, 3, 4, 5, 6, 7 });
     }
 
+    SECTION("Copy to raw buffer") {
+        std::array<int, 9> buffer{};
+        flattened.copyTo(buffer.data());
+        CHECK(buffer == std::array<int, 9>{ 1, 2, 3, 4, 5, 6, 7, 0, 0 });
+
+        buffer = {};
+        using View = lz::internal::BasicIteratorView<decltype(flattened.begin())>;
+        View(std::next(flattened.begin(), 2), std::next(flattened.begin(), 5)).copyTo(buffer.begin());
+        CHECK(buffer == std::array<int, 9>{ 3, 4, 5, 0, 0, 0, 0, 0, 0 });
+
+        int sum = 0;
+        lz::toIter(flattened).forEach([&sum](int i) { sum += i; });
+        CHECK(sum == 28);
+    }
+
     SECTION("To other container using to<>()") {
         CHECK(flattened.to<std::list>() == std::list<int>{ 1, 2, 3, 4, 5, 6, 7 });
     }
@@ -1,8 +1,10 @@
 #include "Lz/FunctionTools.hpp"
 #include "Lz/Range.hpp"
+#include "Lz/Shuffled.hpp"
 
 #include <catch2/catch.hpp>
 #include <cctype>
+#include <numeric>
 
 TEST_CASE("Function tools") {
     std::vector<int> ints = { 1, 2, 3, 4 };
@@ -22,6 +24,113 @@ TEST_CASE("Function tools") {
         CHECK(median == Approx(3.3));
     }
 
+    SECTION("Quantiles") {
+        CHECK(lz::quantiles(doubles, { 0., 0.5, 1. }) == std::vector<double>{ 1.2, lz::median(doubles), 4.5 });
+        CHECK(lz::quantiles(std::vector<int>(), { 0.5, 0.9 }) == std::vector<double>{ 0., 0. });
+
+        std::vector<int> shuffled = lz::range(1001).toVector();
+        std::reverse(shuffled.begin() + 200, shuffled.end());
+        std::rotate(shuffled.begin(), shuffled.begin() + 333, shuffled.end());
+        const std::vector<double> qs = { 0.99, 0.5, 0.9, 0.0005, 0.5 };
+        const std::vector<double> expected = { 990., 500., 900., 0.5, 500. };
+        CHECK(lz::quantiles(shuffled, qs) == expected);
+        CHECK(lz::quantiles(lz::filter(shuffled, [](int) { return true; }), qs) == expected);
+        CHECK(lz::quantiles(shuffled, qs, std::greater<int>()) == std::vector<double>{ 10., 500., 100., 999.5, 500. });
+
+        // The buffer is only partially sorted
+        CHECK(lz::quantilesInPlace(shuffled.begin(), shuffled.end(), qs) == expected);
+        CHECK(!std::is_sorted(shuffled.begin(), shuffled.end()));
+        CHECK(shuffled[990] == 990);
+        CHECK(shuffled[500] == 500);
+    }
+
+    SECTION("Stats") {
+        const auto checkStats = [](const lz::Stats<int>& stats, const std::vector<int>& values) {
+            const double mean = lz::mean(values);
+            double variance = 0;
+            for (const int value : values) {
+                variance += (value - mean) * (value - mean);
+            }
+            CHECK(stats.count == values.size());
+            CHECK(stats.sum == std::accumulate(values.begin(), values.end(), 0));
+            CHECK(stats.mean == Approx(mean));
+            CHECK(stats.variance == Approx(variance / static_cast<double>(values.size())));
+            CHECK(stats.min == *std::min_element(values.begin(), values.end()));
+            CHECK(stats.max == *std::max_element(values.begin(), values.end()));
+        };
+        // Contiguous, with a length that is not a multiple of the amount of lanes
+        std::vector<int> values = { 7, -3, 12, 5, 5, 100, -40, 8, 1, 0, 3 };
+        checkStats(lz::stats(values), values);
+
+        // Evaluated once
+        int calls = 0;
+        auto filtered = lz::filter(values, [&calls](const int i) {
+            ++calls;
+            return i > 0;
+        });
+        const lz::Stats<int> filteredStats = lz::stats(filtered);
+        CHECK(calls == static_cast<int>(values.size()));
+        checkStats(filteredStats, { 7, 12, 5, 5, 100, 8, 1, 3 });
+
+        const auto doubleStats = lz::stats(std::vector<double>{ 1e9 + 4, 1e9 + 7, 1e9 + 13, 1e9 + 16 });
+        CHECK(doubleStats.mean == Approx(1e9 + 10));
+        CHECK(doubleStats.variance == Approx(22.5));
+
+        const auto empty = lz::stats(std::vector<int>());
+        CHECK(empty.count == 0);
+        CHECK(empty.mean == 0);
+        CHECK(empty.variance == 0);
+    }
+
+    SECTION("Top k") {
+        std::vector<int> values = lz::range(1000).toVector();
+        std::reverse(values.begin() + 300, values.end());
+        std::rotate(values.begin(), values.begin() + 444, values.end());
+
+        CHECK(lz::topK(values, 3) == std::vector<int>{ 999, 998, 997 });
+        CHECK(lz::topK(values, 3, std::greater<int>()) == std::vector<int>{ 0, 1, 2 });
+        CHECK(lz::topK(values, 0).empty());
+        // Uses nth_element because k is a large part of the sequence
+        CHECK(lz::topK(values, 600) == lz::range(999, 399, -1).toVector());
+        CHECK(lz::topK(std::vector<int>{ 2, 1 }, 5) == std::vector<int>{ 2, 1 });
+
+        auto evens = lz::filter(values, [](const int i) { return i % 2 == 0; });
+        CHECK(lz::topK(evens, 2) == std::vector<int>{ 998, 996 });
+        CHECK(lz::topKBy(evens, 2, [](const int i) { return -i; }) == std::vector<int>{ 0, 2 });
+    }
+
+    SECTION("To sorted vector") {
+        std::vector<int> values = lz::shuffled(lz::range(-500, 500).toVector(), 11).toVector();
+        CHECK(lz::toSortedVector(values) == lz::range(-500, 500).toVector());
+        CHECK(lz::toSortedVector(values, [](const int i) { return -i; }) == lz::range(499, -501, -1).toVector());
+        CHECK(lz::toSortedVector(std::vector<int>()).empty());
+
+        // Long enough to be radix sorted
+        std::vector<double> reals = lz::map(values, [](const int i) { return i * 0.75; }).toVector();
+        reals.insert(reals.end(), { 1e300, -1e300, 1e-300, -1e-300 });
+        std::vector<double> expected = reals;
+        std::sort(expected.begin(), expected.end());
+        CHECK(lz::toSortedVector(reals) == expected);
+
+        // Stable, and keyFn is called once per element
+        std::vector<std::pair<unsigned char, int>> pairs;
+        for (const int i : lz::range(1000)) {
+            pairs.emplace_back(static_cast<unsigned char>(values[static_cast<std::size_t>(i)] % 7 + 7), i);
+        }
+        int calls = 0;
+        const auto byFirst = lz::toSortedVector(lz::filter(pairs, [](const std::pair<unsigned char, int>&) { return true; }),
+                                                [&calls](const std::pair<unsigned char, int>& pair) {
+                                                    ++calls;
+                                                    return pair.first;
+                                                });
+        CHECK(calls == 1000);
+        CHECK(std::is_sorted(byFirst.begin(), byFirst.end()));
+
+        // Keys that cannot be radix sorted
+        const std::vector<std::string> strings = { "b", "c", "a" };
+        CHECK(lz::toSortedVector(strings) == std::vector<std::string>{ "a", "b", "c" });
+    }
+
     SECTION("Sum to") {
         CHECK(lz::sumTo(4) == 10);
         CHECK(lz::sumTo(5, 10) == 45);
@@ -1,5 +1,7 @@
 #include <Lz/Loop.hpp>
+#include <Lz/Lz.hpp>
 #include <catch2/catch.hpp>
+#include <list>
 
 TEST_CASE("Basic functionality loop", "[Loop][Basic functionality]") {
     std::vector<int> vec = { 1, 2, 3, 4 };
@@ -33,4 +35,49 @@ TEST_CASE("Basic functionality loop", "[Loop][Basic functionality]") {
         CHECK(looper.end() >= looper.begin());
         CHECK(looper.end() <= looper.begin());
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Finite loop", "[Loop][Basic functionality]") {
+    std::vector<int> vec = { 1, 2, 3 };
+    const std::vector<int> expected = { 1, 2, 3, 1, 2, 3, 1, 2, 3 };
+    auto looper = lz::loop(vec, 3);
+
+    SECTION("Size and distance") {
+        CHECK(looper.size() == 9);
+        CHECK(looper.end() - looper.begin() == 9);
+        CHECK(looper.begin() - looper.end() == -9);
+        CHECK(lz::loop(vec, 0).size() == 0);
+        CHECK(lz::loop(std::vector<int>(), 3).size() == 0);
+
+        std::list<int> lst = { 1, 2, 3 };
+        CHECK(lz::loop(lst, 4).size() == 12);
+        CHECK(lz::loop(lst, 4).to<std::list>().size() == 12);
+    }
+
+    SECTION("Iterating") {
+        CHECK(std::vector<int>(looper.begin(), looper.end()) == expected);
+        CHECK(*(looper.begin() + 4) == 2);
+        CHECK(*(looper.end() - 1) == 3);
+        CHECK(*(--looper.end()) == 3);
+        CHECK((looper.begin() + 9) == looper.end());
+        CHECK(looper.begin() + 3 < looper.begin() + 4);
+        CHECK(looper.begin() + 3 > looper.begin() + 2);
+    }
+
+    SECTION("Copying") {
+        CHECK(looper.toVector() == expected);
+        std::vector<int> copied(9);
+        looper.copyTo(copied.begin());
+        CHECK(copied == expected);
+
+        const auto looped = lz::loopRange(vec.begin(), vec.end(), 3);
+        auto part = lz::toIterRange(looped.begin() + 2, looped.end() - 1);
+        const std::vector<int> expectedPart(expected.begin() + 2, expected.end() - 1);
+        CHECK(part.toVector() == expectedPart);
+        std::vector<int> visited;
+        part.forEach([&visited](const int i) { visited.push_back(i); });
+        CHECK(visited == expectedPart);
+
+        CHECK(lz::toIter(vec).loop(2).toVector() == std::vector<int>{ 1, 2, 3, 1, 2, 3 });
+    }
+}
@@ -113,6 +113,22 @@ for (auto [chunk, expectedArr] : lz::zip(chunks, expected)) {
         CHECK(*std::next(cart.begin(), 2) == std::make_tuple(2, 3));
         CHECK(*std::next(cart.begin(), 3) == std::make_tuple(2, 4));
         CHECK(std::next(cart.begin(), 4) == cart.end());
+
+        std::vector<std::tuple<int, int>> visited;
+        cart.forEach([&visited](std::tuple<int&, int&> t) { visited.emplace_back(t); });
+        CHECK(visited == cart.toVector());
+        const auto multiplyAdd = [](int acc, std::tuple<int&, int&> t) { return acc + std::get<0>(t) * std::get<1>(t); };
+        CHECK(cart.foldl(0, multiplyAdd) == 3 + 4 + 6 + 8);
+        CHECK(cart.count(std::make_tuple(2, 3)) == 1);
+
+        std::array<int, 3> c = { 5, 6, 7 };
+        auto cart3 = lz::toIter(a).cartesian(b, c);
+        CHECK(cart3.foldl(0, [](int acc, std::tuple<int&, int&, int&> t) { return acc + std::get<2>(t); }) == 4 * (5 + 6 + 7));
+        // Not spanning the whole product
+        auto sliced = lz::toIter(cart3).drop(2);
+        CHECK(sliced.count(std::make_tuple(1, 3, 5)) == 0);
+        CHECK(sliced.count(std::make_tuple(1, 3, 7)) == 1);
+        CHECK(sliced.toVector().size() == 10);
     }
 
     SECTION("Flatten") {
@@ -32,6 +32,44 @@ TEST_CASE("Map changing and creating elements", "[Map][Basic functionality]") {
             static_cast<void>(_);
         }
     }
+
+    SECTION("Should fuse a map of a map") {
+        auto lengths = lz::map(lz::map(array, [](const TestStruct& t) { return t.testFieldStr; }),
+                               [](const std::string& s) { return s.size() + 1; });
+        static_assert(std::is_same<decltype(lengths.begin().base()), const decltype(array.begin())&>::value,
+                      "Map of a map should be a single map over the array");
+        CHECK(lengths.toVector() == std::vector<std::size_t>{ 7, 7, 7 });
+        CHECK(lengths.end() - lengths.begin() == 3);
+    }
+}
+
+TEST_CASE("Memoized map", "[Map][Basic functionality]") {
+    std::vector<int> inputs = { 1, 2, 1, 1, 3, 2, 1, 3 };
+    int calls = 0;
+    const auto square = [&calls](const int i) {
+        ++calls;
+        return i * i;
+    };
+
+    SECTION("Should only call the function on a miss") {
+        auto map = lz::memoMap(inputs, square, 64);
+        CHECK(map.toVector() == std::vector<int>{ 1, 4, 1, 1, 9, 4, 1, 9 });
+        CHECK(calls == 3);
+        CHECK(map.toVector() == std::vector<int>{ 1, 4, 1, 1, 9, 4, 1, 9 });
+        CHECK(calls == 3);
+    }
+
+    SECTION("Should overwrite slots if the cache is full") {
+        auto map = lz::memoMap(inputs, square, 1);
+        CHECK(map.toVector() == std::vector<int>{ 1, 4, 1, 1, 9, 4, 1, 9 });
+        CHECK(calls == 7);
+    }
+
+    SECTION("Should work with strings") {
+        std::vector<std::string> words = { "a", "bb", "a", "ccc" };
+        auto sizes = lz::memoMap(words, [](const std::string& s) { return s.size(); }, 16);
+        CHECK(sizes.toVector() == std::vector<std::size_t>{ 1, 2, 1, 3 });
+    }
 }
 
 TEST_CASE("Map binary operations", "[Map][Binary ops]") {
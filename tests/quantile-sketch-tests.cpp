@@ -0,0 +1,83 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <list>
+
+namespace {
+// The exact fraction of values in `sorted` that are <= value
+double exactRank(const std::vector<int>& sorted, const int value) {
+    return static_cast<double>(std::upper_bound(sorted.begin(), sorted.end(), value) - sorted.begin()) /
+           static_cast<double>(sorted.size());
+}
+} // namespace
+
+TEST_CASE("QuantileSketch basic functionality", "[QuantileSketch][Basic functionality]") {
+    SECTION("Small sequences are exact") {
+        std::list<int> list = { 5, 1, 4, 2, 3 };
+        auto sketch = lz::quantileSketch(list);
+        CHECK(sketch.count() == 5);
+        CHECK(sketch.min() == 1);
+        CHECK(sketch.max() == 5);
+        CHECK(sketch.quantile(0) == 1);
+        CHECK(sketch.quantile(0.5) == 3);
+        CHECK(sketch.quantile(1) == 5);
+        CHECK(sketch.rank(2) == Approx(0.4));
+        CHECK(sketch.quantiles({ 0.2, 0.8 }) == std::vector<int>{ 1, 4 });
+    }
+
+    SECTION("Empty sketch") {
+        std::vector<int> vec;
+        auto sketch = lz::quantileSketch(vec);
+        CHECK(sketch.empty());
+        CHECK(sketch.rank(1) == 0);
+    }
+
+    SECTION("Lazy views") {
+        auto sketch = lz::toIter(lz::range(1000))
+                          .map([](const int i) { return i * 2; })
+                          .filter([](const int i) { return i % 3 == 0; })
+                          .quantileSketch();
+        CHECK(sketch.count() == 334);
+        CHECK(sketch.min() == 0);
+        CHECK(sketch.max() == 1998);
+    }
+}
+
+TEST_CASE("QuantileSketch accuracy", "[QuantileSketch][Basic functionality]") {
+    constexpr double epsilon = 0.01;
+    std::vector<int> vec = lz::range(100000).toVector();
+    auto shuffled = lz::shuffled(vec, 7);
+    std::vector<int> sorted = vec;
+
+    SECTION("Single sketch") {
+        auto sketch = lz::quantileSketch(shuffled, epsilon);
+        CHECK(sketch.count() == vec.size());
+        CHECK(sketch.storedCount() < 2000);
+        for (const double q : { 0.01, 0.1, 0.5, 0.9, 0.99, 0.999 }) {
+            CHECK(std::abs(exactRank(sorted, sketch.quantile(q)) - q) <= epsilon);
+        }
+    }
+
+    SECTION("Merged sketches") {
+        auto sketch = lz::quantileSketchRange(shuffled.begin(), shuffled.begin() + 30000, epsilon);
+        auto other = lz::quantileSketchRange(shuffled.begin() + 30000, shuffled.end(), epsilon);
+        sketch.merge(other);
+        CHECK(sketch.count() == vec.size());
+        CHECK(sketch.min() == 0);
+        CHECK(sketch.max() == 99999);
+        for (const double q : { 0.01, 0.1, 0.5, 0.9, 0.99, 0.999 }) {
+            CHECK(std::abs(exactRank(sorted, sketch.quantile(q)) - q) <= epsilon);
+        }
+    }
+
+    SECTION("Merged with itself") {
+        auto sketch = lz::quantileSketch(shuffled, epsilon);
+        sketch.merge(sketch);
+        CHECK(sketch.count() == 2 * vec.size());
+        CHECK(sketch.min() == 0);
+        CHECK(sketch.max() == 99999);
+        for (const double q : { 0.01, 0.1, 0.5, 0.9, 0.99, 0.999 }) {
+            CHECK(std::abs(exactRank(sorted, sketch.quantile(q)) - q) <= epsilon);
+        }
+    }
+}
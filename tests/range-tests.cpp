@@ -1,6 +1,8 @@
+#include <Lz/Lz.hpp>
 #include <Lz/Range.hpp>
 #include <catch2/catch.hpp>
 #include <list>
+#include <numeric>
 
 TEST_CASE("Range changing and creating elements", "[Range][Basic functionality]") {
     SECTION("Looping upwards") {
@@ -40,6 +42,56 @@ TEST_CASE("Range changing and creating elements", "[Range][Basic functionality]"
     }
 }
 
+TEST_CASE("Range closed form reductions", "[Range][Basic functionality]") {
+    struct Expected {
+        int start;
+        int end;
+        int step;
+    };
+    const Expected ranges[] = { { 0, 10, 1 }, { 3, 20, 2 }, { 0, 6, 3 }, { 0, 9, 3 }, { 10, 0, -1 },
+                                { 10, -7, -3 }, { -5, 5, 4 }, { 4, 4, 1 }, { 5, 0, 1 }, { 0, 5, -1 } };
+
+    for (const Expected& r : ranges) {
+        std::vector<int> expected;
+        for (int i = r.start; r.step < 0 ? i > r.end : i < r.end; i += r.step) {
+            expected.push_back(i);
+        }
+        auto range = lz::toIter(lz::range(r.start, r.end, r.step));
+        INFO("range(" << r.start << ", " << r.end << ", " << r.step << ")");
+
+        CHECK(range.toVector() == expected);
+        CHECK(range.sum() == std::accumulate(expected.begin(), expected.end(), 0));
+        CHECK(range.foldl(100LL, std::plus<>()) == std::accumulate(expected.begin(), expected.end(), 100LL));
+        CHECK(range.foldl(0.5, std::plus<int>()) == std::accumulate(expected.begin(), expected.end(), 0.5, std::plus<int>()));
+
+        std::vector<int> copied(expected.size());
+        range.copyTo(copied.begin());
+        CHECK(copied == expected);
+
+        for (int value = -12; value <= 22; ++value) {
+            const auto pos = std::find(expected.begin(), expected.end(), value);
+            const auto index = pos == expected.end() ? lz::npos : static_cast<std::size_t>(pos - expected.begin());
+            CHECK(static_cast<std::size_t>(range.indexOf(value)) == index);
+            CHECK(range.contains(value) == (pos != expected.end()));
+            CHECK(range.count(value) == std::count(expected.begin(), expected.end(), value));
+        }
+
+        if (expected.empty()) {
+            continue;
+        }
+        CHECK(range.size() == expected.size());
+        CHECK(range.max() == *std::max_element(expected.begin(), expected.end()));
+        CHECK(range.min() == *std::min_element(expected.begin(), expected.end()));
+        CHECK(range.mean() == lz::mean(expected));
+        CHECK(range.median() == lz::median(expected));
+    }
+
+    // The intermediate products of the closed form overflow int, but the sum itself does not
+    CHECK(lz::toIter(lz::range(-50000, 50001)).sum() == 0);
+    CHECK(lz::toIter(lz::range(50000, -50001, -1)).sum() == 0);
+    CHECK(lz::toIter(lz::range(-50000, 50001)).foldl(7, std::plus<>()) == 7);
+}
+
 TEST_CASE("Range binary operations", "[Range][Binary ops]") {
     constexpr int size = 10;
     auto range = lz::range(size);
@@ -2,6 +2,7 @@
 #include <array>
 #include <catch2/catch.hpp>
 #include <list>
+#include <string>
 
 TEST_CASE("Repeat changing and creating elements", "[Repeat][Basic functionality]") {
     int toRepeat = 20;
@@ -122,3 +123,16 @@ TEST_CASE("Repeat to containers", "[Repeat][To container]") {
         CHECK(actual == expected);
     }
 }
+
+TEST_CASE("Repeat bulk fill", "[Repeat][To container]") {
+    auto repeater = lz::repeat('a', 5);
+
+    std::array<char, 5> array{};
+    repeater.copyTo(array.begin());
+    CHECK(array == std::array<char, 5>{ 'a', 'a', 'a', 'a', 'a' });
+
+    CHECK(repeater.to<std::string>() == "aaaaa");
+    CHECK(repeater.toVector() == std::vector<char>(5, 'a'));
+    CHECK(lz::repeat('a', 0).toVector().empty());
+}
+
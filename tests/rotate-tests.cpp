@@ -1,8 +1,10 @@
 #include "Lz/FunctionTools.hpp"
+#include "Lz/Lz.hpp"
 #include "Lz/Rotate.hpp"
 
 #include <catch2/catch.hpp>
 #include <list>
+#include <numeric>
 
 TEST_CASE("Rotate basic functionality", "[Rotate][Basic functionality]") {
     std::array<int, 5> arr = { 1, 2, 3, 4, 5 };
@@ -156,3 +158,29 @@ TEST_CASE("Rotate to containers", "[Rotate][To container]") {
         CHECK(map == std::unordered_map<int, int>{ { 3, 3 }, { 4, 4 }, { 5, 5 }, { 6, 6 }, { 1, 1 }, { 2, 2 } });
     }
 }
+
+TEST_CASE("Rotate in two segments", "[Rotate][Basic functionality]") {
+    std::vector<int> vec(7);
+    std::iota(vec.begin(), vec.end(), 1);
+
+    for (std::ptrdiff_t start = 0; start < static_cast<std::ptrdiff_t>(vec.size()); ++start) {
+        for (std::ptrdiff_t skip = 0; skip <= static_cast<std::ptrdiff_t>(vec.size()); ++skip) {
+            std::vector<int> expected(vec.size());
+            std::rotate_copy(vec.begin(), vec.begin() + start, vec.end(), expected.begin());
+            expected.erase(expected.begin(), expected.begin() + skip);
+
+            auto rotator = lz::rotate(vec, start);
+            auto chain = lz::toIterRange(rotator.begin() + skip, rotator.end());
+
+            std::vector<int> copied;
+            chain.copyTo(std::back_inserter(copied));
+            CHECK(copied == expected);
+
+            std::vector<int> visited;
+            chain.forEach([&visited](const int i) { visited.push_back(i); });
+            CHECK(visited == expected);
+
+            CHECK(chain.foldl(0, std::plus<int>()) == std::accumulate(expected.begin(), expected.end(), 0));
+        }
+    }
+}
@@ -0,0 +1,140 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <forward_list>
+#include <list>
+
+TEST_CASE("Sample basic functionality", "[Sample][Basic functionality]") {
+    std::mt19937 gen(1234);
+
+    SECTION("Should contain k distinct elements of the sequence") {
+        auto range = lz::range(1000);
+        std::vector<int> sample = lz::sample(range, 50, gen);
+        CHECK(sample.size() == 50);
+        std::sort(sample.begin(), sample.end());
+        CHECK(std::adjacent_find(sample.begin(), sample.end()) == sample.end());
+        CHECK(sample.front() >= 0);
+        CHECK(sample.back() < 1000);
+    }
+
+    SECTION("Should return all elements if the sequence is smaller than k") {
+        std::list<int> list = { 1, 2, 3 };
+        CHECK(lz::sample(list, 10, gen) == std::vector<int>{ 1, 2, 3 });
+    }
+
+    SECTION("Empty sample") {
+        std::vector<int> vec = { 1, 2, 3 };
+        CHECK(lz::sample(vec, 0, gen).empty());
+        std::vector<int> empty;
+        CHECK(lz::sample(empty, 5, gen).empty());
+    }
+
+    SECTION("Should be uniform") {
+        constexpr int size = 20;
+        constexpr std::size_t k = 5;
+        constexpr int runs = 4000;
+        std::forward_list<int> forwardList(size);
+        std::iota(forwardList.begin(), forwardList.end(), 0);
+        std::vector<int> randomAccess(forwardList.begin(), forwardList.end());
+
+        std::array<int, size> forwardCounts{};
+        std::array<int, size> randomAccessCounts{};
+        for (int i = 0; i < runs; i++) {
+            for (const int value : lz::sample(forwardList, k, gen)) {
+                ++forwardCounts[static_cast<std::size_t>(value)];
+            }
+            for (const int value : lz::sample(randomAccess, k, gen)) {
+                ++randomAccessCounts[static_cast<std::size_t>(value)];
+            }
+        }
+        // Expected: runs * k / size = 1000 per element
+        const auto inRange = [](int count) { return count > 850 && count < 1150; };
+        CHECK(std::all_of(forwardCounts.begin(), forwardCounts.end(), inRange));
+        CHECK(std::all_of(randomAccessCounts.begin(), randomAccessCounts.end(), inRange));
+    }
+
+    SECTION("Should work with the default engine") {
+        std::vector<int> vec = { 1, 2, 3, 4, 5 };
+        CHECK(lz::sample(vec, 3).size() == 3);
+    }
+}
+
+TEST_CASE("Sample rate basic functionality", "[SampleRate][Basic functionality]") {
+    std::mt19937 gen(4321);
+
+    SECTION("Should keep the order of the sequence") {
+        auto range = lz::range(10000);
+        std::vector<int> sampled = lz::sampleRate(range, 0.1, gen).toVector();
+        CHECK(std::is_sorted(sampled.begin(), sampled.end()));
+        CHECK(std::adjacent_find(sampled.begin(), sampled.end()) == sampled.end());
+        // Expected: 1000
+        CHECK(sampled.size() > 900);
+        CHECK(sampled.size() < 1100);
+    }
+
+    SECTION("Probability of 1 should yield everything") {
+        std::forward_list<int> forwardList = { 1, 2, 3, 4 };
+        auto sampled = lz::sampleRate(forwardList, 1., gen);
+        CHECK(sampled.toVector() == std::vector<int>{ 1, 2, 3, 4 });
+    }
+
+    SECTION("Should be an input view") {
+        std::vector<int> vec = { 1, 2, 3 };
+        auto sampled = lz::sampleRate(vec, 0.5, gen);
+        static_assert(std::is_same<decltype(sampled.begin())::iterator_category, std::input_iterator_tag>::value,
+                      "Every pass yields another subsequence");
+        CHECK(sampled.toVector().size() <= vec.size());
+    }
+
+    SECTION("Should be empty for empty sequences") {
+        std::vector<int> empty;
+        auto sampled = lz::sampleRate(empty, 0.5, gen);
+        CHECK(sampled.begin() == sampled.end());
+    }
+
+    SECTION("Should work with string splitters") {
+        std::string text = "a\nb\nc\nd\ne";
+        auto lines = lz::lines(text);
+        CHECK(std::distance(lines.begin(), lines.end()) == 5);
+        auto sampled = lz::sampleRate(lines, 1., gen);
+        CHECK(std::distance(sampled.begin(), sampled.end()) == 5);
+    }
+
+    SECTION("Should be chainable") {
+        std::vector<int> vec = { 1, 2, 3, 4, 5 };
+        auto chain = lz::toIter(vec).map([](int i) { return i * 2; }).sampleRate(1., gen);
+        CHECK(chain.toVector() == std::vector<int>{ 2, 4, 6, 8, 10 });
+        CHECK(chain.sample(2, gen).size() == 2);
+    }
+}
+
+TEST_CASE("Sample rate binary operations", "[SampleRate][Binary ops]") {
+    std::array<int, 4> array = { 1, 2, 3, 4 };
+    std::mt19937 gen(0);
+    auto sampled = lz::sampleRate(array, 1., gen);
+    auto it = sampled.begin();
+
+    SECTION("Operator++") {
+        ++it;
+        CHECK(*it == 2);
+    }
+
+    SECTION("Operator== & Operator!=") {
+        CHECK(it != sampled.end());
+        it = sampled.end();
+        CHECK(it == sampled.end());
+    }
+}
+
+TEST_CASE("Sample rate to containers", "[SampleRate][To container]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    std::mt19937 gen(0);
+    auto sampled = lz::sampleRate(vec, 1., gen);
+
+    SECTION("To vector") {
+        CHECK(sampled.toVector() == vec);
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(sampled.to<std::list>() == std::list<int>{ 1, 2, 3, 4, 5 });
+    }
+}
@@ -0,0 +1,101 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+
+TEST_CASE("Shuffled basic functionality", "[Shuffled][Basic functionality]") {
+    SECTION("Should be a permutation") {
+        for (const std::size_t size : { 0, 1, 2, 3, 4, 5, 7, 16, 17, 100, 1000, 4097 }) {
+            std::vector<std::size_t> vec(size);
+            std::iota(vec.begin(), vec.end(), std::size_t(0));
+            std::vector<std::size_t> shuffled = lz::shuffled(vec, 42).toVector();
+            CHECK(shuffled.size() == size);
+            std::sort(shuffled.begin(), shuffled.end());
+            CHECK(shuffled == vec);
+        }
+    }
+
+    SECTION("Should be deterministic given a seed") {
+        std::vector<int> vec = lz::range(100).toVector();
+        CHECK(lz::shuffled(vec, 1).toVector() == lz::shuffled(vec, 1).toVector());
+        CHECK(lz::shuffled(vec, 1).toVector() != lz::shuffled(vec, 2).toVector());
+        CHECK(lz::shuffled(vec, 1).toVector() != vec);
+    }
+
+    SECTION("Should return references to the underlying sequence") {
+        std::array<int, 4> array = { 1, 2, 3, 4 };
+        auto shuffled = lz::shuffled(array, 3);
+        for (int& i : shuffled) {
+            i *= 10;
+        }
+        CHECK(array == std::array<int, 4>{ 10, 20, 30, 40 });
+    }
+
+    SECTION("Should work with the default seed") {
+        std::vector<int> vec = { 1, 2, 3 };
+        CHECK(lz::shuffled(vec).size() == 3);
+    }
+}
+
+TEST_CASE("Shuffled binary operations", "[Shuffled][Binary ops]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+    auto shuffled = lz::shuffled(vec, 1234);
+    const std::vector<int> expected = shuffled.toVector();
+    auto it = shuffled.begin();
+
+    SECTION("Operator++") {
+        ++it;
+        CHECK(*it == expected[1]);
+    }
+
+    SECTION("Operator--") {
+        ++it;
+        --it;
+        CHECK(*it == expected[0]);
+    }
+
+    SECTION("Operator== & Operator!=") {
+        CHECK(it != shuffled.end());
+        it = shuffled.end();
+        CHECK(it == shuffled.end());
+    }
+
+    SECTION("Operator+(int), Operator-(int)") {
+        CHECK(*(it + 3) == expected[3]);
+        CHECK(*((it + 3) - 1) == expected[2]);
+    }
+
+    SECTION("Operator-(Iterator)") {
+        CHECK(shuffled.end() - it == 5);
+        CHECK(shuffled.end() - (it + 2) == 3);
+    }
+
+    SECTION("Operator[]()") {
+        CHECK(it[4] == expected[4]);
+    }
+
+    SECTION("Operator<, '<, <=, >, >='") {
+        CHECK(it < shuffled.end());
+        CHECK(it + 6 > shuffled.end());
+        CHECK(it + 5 <= shuffled.end());
+        CHECK(it + 5 >= shuffled.end());
+    }
+}
+
+TEST_CASE("Shuffled to containers", "[Shuffled][To container]") {
+    std::vector<int> vec = { 1, 2, 3, 4, 5 };
+
+    SECTION("To array") {
+        auto array = lz::shuffled(vec, 7).toArray<5>();
+        std::sort(array.begin(), array.end());
+        CHECK(array == std::array<int, 5>{ 1, 2, 3, 4, 5 });
+    }
+
+    SECTION("To other container using to<>()") {
+        CHECK(lz::shuffled(vec, 7).to<std::list>().size() == 5);
+    }
+
+    SECTION("Chained") {
+        auto batches = lz::toIter(vec).shuffled(7).chunks(2).toVector();
+        CHECK(batches.size() == 3);
+    }
+}
@@ -0,0 +1,51 @@
+#include <Lz/Lz.hpp>
+#include <catch2/catch.hpp>
+#include <list>
+
+TEST_CASE("Sorted basic functionality", "[Sorted][Basic functionality]") {
+    std::vector<int> vec = lz::range(1000).toVector();
+    std::vector<int> shuffled = lz::shuffled(vec, 5).toVector();
+
+    SECTION("Should be sorted") {
+        auto sorted = lz::sorted(shuffled);
+        CHECK(static_cast<std::size_t>(sorted.distance()) == vec.size());
+        CHECK(sorted.toVector() == vec);
+        CHECK(lz::sorted(shuffled, std::greater<int>()).toVector() == lz::range(999, -1, -1).toVector());
+        CHECK(lz::sorted(std::vector<int>()).toVector().empty());
+    }
+
+    SECTION("Should sort element by element") {
+        auto sorted = lz::sorted(shuffled);
+        int expected = 0;
+        for (const int i : sorted) {
+            CHECK(i == expected);
+            ++expected;
+        }
+        CHECK(expected == 1000);
+        CHECK(sorted.begin()[500] == 500);
+        CHECK(*(sorted.end() - 1) == 999);
+    }
+
+    SECTION("Should only sort what is used") {
+        std::vector<int> large = lz::shuffled(lz::range(100000).toVector(), 3).toVector();
+        std::size_t comparisons = 0;
+        auto sorted = lz::sorted(large, [&comparisons](const int a, const int b) {
+            ++comparisons;
+            return a < b;
+        });
+        CHECK(lz::take(sorted, 10).toVector() == lz::range(10).toVector());
+        CHECK(comparisons < large.size() * 6);
+        CHECK(lz::take(sorted, 20).toVector() == lz::range(20).toVector());
+        CHECK(comparisons < large.size() * 6);
+    }
+
+    SECTION("Should work with forward iterators and in chains") {
+        std::list<int> list(shuffled.begin(), shuffled.end());
+        auto smallEvens = lz::toIter(list)
+                              .filter([](const int i) { return i % 2 == 0; })
+                              .sorted()
+                              .takeWhile([](const int i) { return i < 10; })
+                              .toVector();
+        CHECK(smallEvens == std::vector<int>{ 0, 2, 4, 6, 8 });
+    }
+}
@@ -1,7 +1,10 @@
+#include <Lz/Lz.hpp>
 #include <Lz/TakeEvery.hpp>
 #include <array>
 #include <catch2/catch.hpp>
 #include <list>
+#include <numeric>
+#include <vector>
 
 TEST_CASE("TakeEvery changing and creating elements", "[TakeEvery][Basic functionality]") {
     constexpr std::size_t size = 4;
@@ -163,3 +166,29 @@ TEST_CASE("TakeEvery to containers", "[TakeEvery][To container]") {
         CHECK(actual == expected);
     }
 }
+
+TEST_CASE("TakeEvery random access size and copy", "[TakeEvery][Binary ops]") {
+    std::vector<int> vec(13);
+    std::iota(vec.begin(), vec.end(), 0);
+
+    for (std::ptrdiff_t offset = 1; offset <= 6; ++offset) {
+        for (std::ptrdiff_t start = 0; start <= 3; ++start) {
+            std::vector<int> expected;
+            for (std::ptrdiff_t i = start; i < static_cast<std::ptrdiff_t>(vec.size()); i += offset) {
+                expected.push_back(vec[static_cast<std::size_t>(i)]);
+            }
+            auto takeEvery = lz::takeEvery(vec, offset, start);
+            CHECK(static_cast<std::size_t>(takeEvery.size()) == expected.size());
+            CHECK(takeEvery.end() - takeEvery.begin() == static_cast<std::ptrdiff_t>(expected.size()));
+
+            std::vector<int> copied;
+            takeEvery.copyTo(std::back_inserter(copied));
+            CHECK(copied == expected);
+            CHECK(takeEvery.toVector() == expected);
+
+            std::vector<int> visited;
+            lz::toIter(takeEvery).forEach([&visited](const int i) { visited.push_back(i); });
+            CHECK(visited == expected);
+        }
+    }
+}
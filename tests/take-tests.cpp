@@ -1,5 +1,7 @@
+#include <Lz/Filter.hpp>
 #include <Lz/Take.hpp>
 #include <catch2/catch.hpp>
+#include <forward_list>
 #include <list>
 
 TEST_CASE("Take changing and creating elements", "[Take][Basic functionality]") {
@@ -251,4 +253,25 @@ TEST_CASE("DropWhile to containers", "[DropWhile][To container]") {
         std::unordered_map<int, int> expected = { std::make_pair(2, 2), std::make_pair(1, 1) };
         CHECK(map == expected);
     }
+}
+
+TEST_CASE("Drop from forward sequences", "[Take][Basic functionality]") {
+    std::forward_list<int> list = { 1, 2, 3, 4, 5 };
+    CHECK(lz::drop(list, 2).toVector() == std::vector<int>{ 3, 4, 5 });
+    CHECK(lz::dropRange(list.begin(), list.end(), 0).toVector() == std::vector<int>{ 1, 2, 3, 4, 5 });
+    CHECK(lz::drop(list, 5).toVector().empty());
+
+    std::vector<int> vec(100);
+    for (std::size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>(i);
+    }
+    std::size_t calls = 0;
+    auto filtered = lz::filter(vec, [&calls](const int i) {
+        ++calls;
+        return i % 2 == 0;
+    });
+    auto dropped = lz::drop(filtered, 2);
+    CHECK(calls < 10);
+    CHECK(*dropped.begin() == 4);
+    CHECK(dropped.toVector().size() == 48);
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
+#include <Lz/Lz.hpp>
 #include <Lz/Zip.hpp>
 #include <catch2/catch.hpp>
 #include <list>
+#include <numeric>
 
 TEST_CASE("Zip changing and creating elements", "[Zip][Basic functionality]") {
     std::vector<int> a = { 1, 2, 3, 4 };
@@ -53,6 +55,49 @@ TEST_CASE("Zip changing and creating elements", "[Zip][Basic functionality]") {
     }
 }
 
+TEST_CASE("Zip contiguous and non contiguous iterators", "[Zip][Basic functionality]") {
+    std::vector<int> a = { 1, 2, 3, 4, 5 };
+    std::array<int, 4> b = { 10, 20, 30, 40 };
+    std::list<int> c = { 100, 200, 300, 400 };
+
+    SECTION("Contiguous") {
+        auto zipper = lz::zip(a, b);
+        auto begin = zipper.begin();
+        auto end = zipper.end();
+        CHECK(end - begin == 4);
+        CHECK(begin - end == -4);
+        CHECK(*(end - 1) == std::make_tuple(4, 40));
+        CHECK(begin[2] == std::make_tuple(3, 30));
+        CHECK(begin + 4 == end);
+        CHECK(end - 4 == begin);
+        CHECK(*(end - 3 + 1) == std::make_tuple(3, 30));
+        CHECK((begin + 2) - (end - 1) == -1);
+    }
+
+    SECTION("forEach, copyTo and foldl") {
+        auto zipper = lz::toIter(lz::zip(a, b));
+        int sum = 0;
+        zipper.forEach([&sum](std::tuple<int&, int&> tup) { sum += std::get<0>(tup) * std::get<1>(tup); });
+        CHECK(sum == 300);
+        CHECK(zipper.foldl(0, [](int acc, std::tuple<int&, int&> tup) { return acc + std::get<1>(tup); }) == 100);
+
+        std::vector<std::tuple<int, int>> copied(4);
+        zipper.copyTo(copied.begin());
+        CHECK(copied == std::vector<std::tuple<int, int>>{ { 1, 10 }, { 2, 20 }, { 3, 30 }, { 4, 40 } });
+
+        auto zipWith = lz::zipWith([](int x, int y) { return x * y; }, a, b);
+        CHECK(std::accumulate(zipWith.begin(), zipWith.end(), 0) == 300);
+        CHECK(lz::toIter(zipWith).sum() == 300);
+    }
+
+    SECTION("Mixed with non contiguous") {
+        auto zipper = lz::zip(a, c);
+        CHECK(zipper.toVector() == std::vector<std::tuple<int, int>>{ { 1, 100 }, { 2, 200 }, { 3, 300 }, { 4, 400 } });
+        auto end = zipper.end();
+        CHECK(*--end == std::make_tuple(4, 400));
+    }
+}
+
 TEST_CASE("Zip binary operations", "[Zip][Binary ops]") {
     constexpr std::size_t size = 4;
     std::vector<int> a = { 1, 2, 3, 4 };